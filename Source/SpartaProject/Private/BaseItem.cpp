@@ -1,141 +1,252 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "BaseItem.h"
-#include "Components/SphereComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "Particles/ParticleSystemComponent.h"
-#include "Components/AudioComponent.h"
-
-ABaseItem::ABaseItem()
-{
-	PrimaryActorTick.bCanEverTick = true;
-
-	// 루트 컴포넌트 생성 및 설정
-	Scene = CreateDefaultSubobject<USceneComponent>(TEXT("Scene"));
-	SetRootComponent(Scene);
-
-	// 충돌 컴포넌트 생성 및 설정
-	Collision = CreateDefaultSubobject<USphereComponent>(TEXT("Collision"));
-	// 겹침만 감지하는 프로파일 설정
-	Collision->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
-	// 루트 컴포넌트에 부착
-	Collision->SetupAttachment(Scene);
-
-	// 스태틱 메시 컴포넌트 생성 및 설정
-	StaticMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMesh"));
-	StaticMesh->SetupAttachment(Collision);
-	// 메시가 불필요하게 충돌을 막지 않도록 비활성화
-	StaticMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-
-	// Overlap 이벤트 바인딩
-	Collision->OnComponentBeginOverlap.AddDynamic(this, &ABaseItem::OnItemOverlap);
-	Collision->OnComponentEndOverlap.AddDynamic(this, &ABaseItem::OnItemEndOverlap);
-
-	// 기본 회전 속도 (초당 90도)
-	RotationSpeed = 90.f;
-}
-
-void ABaseItem::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	// Y축(Yaw)을 기준으로 회전
-	FRotator NewRotation = GetActorRotation();
-	NewRotation.Yaw += RotationSpeed * DeltaTime;
-	SetActorRotation(NewRotation);
-}
-
-void ABaseItem::OnItemOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-	// OtherActor가 유효하고 플레이어인지 확인
-	if (OtherActor && OtherActor->ActorHasTag("Player"))
-	{
-		// 아이템 사용 (획득) 로직 호출
-		ActivateItem(OtherActor);
-	}
-}
-
-void ABaseItem::OnItemEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
-{
-}
-
-void ABaseItem::ActivateItem(AActor* Activator)
-{
-	UParticleSystemComponent* Particle = nullptr;
-	UAudioComponent* AudioComp = nullptr;
-
-	if (PickupParticle)
-	{
-		Particle = UGameplayStatics::SpawnEmitterAtLocation(
-			GetWorld(),
-			PickupParticle,
-			GetActorLocation(),
-			GetActorRotation(),
-			true);
-		
-		// 파티클이 2초 후 자동으로 비활성화되도록 설정
-		if (Particle)
-		{
-			Particle->bAutoDestroy = true;
-			Particle->CustomTimeDilation = 2.0f;
-		}
-	}
-
-	if (PickupSound)
-	{
-		AudioComp = UGameplayStatics::SpawnSoundAtLocation(
-			GetWorld(),
-			PickupSound,
-			GetActorLocation());
-	}
-
-	// 파티클 타이머
-	if (Particle)
-	{
-		FTimerHandle DestroyParticleTimerHandle;
-		TWeakObjectPtr<UParticleSystemComponent> WeakParticle = Particle;
-
-		GetWorld()->GetTimerManager().SetTimer(
-			DestroyParticleTimerHandle,
-			[WeakParticle]()
-			{
-				if (WeakParticle.IsValid())
-				{
-					WeakParticle->Deactivate();
-					WeakParticle->DestroyComponent();
-				}
-			},
-			2.0f,
-			false);
-	}
-
-	// 사운드 타이머
-	if (AudioComp)
-	{
-		FTimerHandle StopSoundTimerHandle;
-		TWeakObjectPtr<UAudioComponent> WeakAudio = AudioComp;
-
-		GetWorld()->GetTimerManager().SetTimer(
-			StopSoundTimerHandle,
-			[WeakAudio]()
-			{
-				if (WeakAudio.IsValid())
-				{
-					WeakAudio->Stop();
-					WeakAudio->DestroyComponent();
-				}
-			},
-			2.0f,
-			false);
-	}
-}
-
-FName ABaseItem::GetItemType() const
-{
-	return ItemType;
-}
-
-void ABaseItem::DestroyItem()
-{
-	Destroy();
-}
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BaseItem.h"
+#include "SpawnVolume.h"
+#include "ItemAnimationSubsystem.h"
+#include "ItemInstancingSubsystem.h"
+#include "ItemProximitySubsystem.h"
+#include "ItemEffectSubsystem.h"
+#include "PickupAudioSubsystem.h"
+#include "SpartaGameState.h"
+#include "SpartaStats.h"
+#include "SpartaCollision.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/Pawn.h"
+
+ABaseItem::ABaseItem()
+{
+	// 회전은 UItemAnimationSubsystem이 일괄 처리하므로 개별 Tick 불필요
+	PrimaryActorTick.bCanEverTick = false;
+
+	// 루트 컴포넌트 생성 및 설정
+	Scene = CreateDefaultSubobject<USceneComponent>(TEXT("Scene"));
+	SetRootComponent(Scene);
+
+	// 충돌 컴포넌트 생성 및 설정
+	Collision = CreateDefaultSubobject<USphereComponent>(TEXT("Collision"));
+	// Pickup 채널 프로파일: 플레이어 캡슐과만 Overlap 쌍이 생기고 다른 아이템/물리 오브젝트/카메라와는 무시
+	Collision->SetCollisionProfileName(SPARTA_PROFILE_PICKUP);
+	Collision->SetGenerateOverlapEvents(true);
+	// 루트 컴포넌트에 부착
+	Collision->SetupAttachment(Scene);
+
+	// 스태틱 메시 컴포넌트 생성 및 설정
+	StaticMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMesh"));
+	StaticMesh->SetupAttachment(Collision);
+	// 메시가 불필요하게 충돌을 막지 않도록 비활성화
+	StaticMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	StaticMesh->SetGenerateOverlapEvents(false);
+
+	// Overlap 이벤트 바인딩
+	Collision->OnComponentBeginOverlap.AddDynamic(this, &ABaseItem::OnItemOverlap);
+	Collision->OnComponentEndOverlap.AddDynamic(this, &ABaseItem::OnItemEndOverlap);
+
+	// 기본 회전 속도 (초당 90도)
+	RotationSpeed = 90.f;
+	BobAmplitude = 0.f;
+	BobFrequency = 0.5f;
+
+	bUseInstancedRendering = false;
+	bUseProximityPickup = true;
+	bUseMassSimulation = false;
+
+	bIsInPool = false;
+	AnimationSlot = INDEX_NONE;
+	ProximityLocation = FVector::ZeroVector;
+	ProximityRadius = 0.f;
+	ProximityCell = FIntVector::ZeroValue;
+	ProximityIndex = INDEX_NONE;
+	RenderInstanceComponent = nullptr;
+	RenderInstanceIndex = INDEX_NONE;
+}
+
+void ABaseItem::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (bUseProximityPickup)
+	{
+		// 픽업은 격자 검사로 처리하므로 구 충돌은 브로드페이즈에서 완전히 제외
+		Collision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Collision->SetGenerateOverlapEvents(false);
+	}
+
+	if (!bIsInPool)
+	{
+		AcquireRenderInstance();
+
+		if (UItemAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UItemAnimationSubsystem>())
+		{
+			AnimationSubsystem->RegisterItem(this);
+		}
+		RegisterProximity();
+	}
+}
+
+void ABaseItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UItemAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UItemAnimationSubsystem>())
+	{
+		AnimationSubsystem->UnregisterItem(this);
+	}
+	UnregisterProximity();
+	ReleaseRenderInstance();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ABaseItem::OnAcquiredFromPool()
+{
+	bIsInPool = false;
+
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	AcquireRenderInstance();
+
+	if (UItemAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UItemAnimationSubsystem>())
+	{
+		AnimationSubsystem->RegisterItem(this);
+	}
+	RegisterProximity();
+}
+
+void ABaseItem::OnReleasedToPool()
+{
+	bIsInPool = true;
+
+	// 폭발 대기 등 이 아이템에 걸린 타이머 정리
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	if (UItemAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UItemAnimationSubsystem>())
+	{
+		AnimationSubsystem->UnregisterItem(this);
+	}
+	UnregisterProximity();
+	ReleaseRenderInstance();
+}
+
+void ABaseItem::RegisterProximity()
+{
+	if (!bUseProximityPickup)
+		return;
+
+	if (UItemProximitySubsystem* ProximitySubsystem = GetWorld()->GetSubsystem<UItemProximitySubsystem>())
+	{
+		ProximitySubsystem->RegisterItem(this);
+	}
+}
+
+void ABaseItem::UnregisterProximity()
+{
+	if (UItemProximitySubsystem* ProximitySubsystem = GetWorld()->GetSubsystem<UItemProximitySubsystem>())
+	{
+		ProximitySubsystem->UnregisterItem(this);
+	}
+}
+
+void ABaseItem::AcquireRenderInstance()
+{
+	if (!bUseInstancedRendering || RenderInstanceComponent)
+		return;
+
+	if (UItemInstancingSubsystem* InstancingSubsystem = GetWorld()->GetSubsystem<UItemInstancingSubsystem>())
+	{
+		if (InstancingSubsystem->AcquireInstance(GetClass(), StaticMesh, StaticMesh->GetComponentTransform(), RenderInstanceComponent, RenderInstanceIndex))
+		{
+			// 인스턴스가 대신 그려주므로 개별 메시는 렌더링하지 않음
+			StaticMesh->SetVisibility(false);
+		}
+	}
+}
+
+void ABaseItem::ReleaseRenderInstance()
+{
+	if (!RenderInstanceComponent)
+		return;
+
+	if (UItemInstancingSubsystem* InstancingSubsystem = GetWorld()->GetSubsystem<UItemInstancingSubsystem>())
+	{
+		InstancingSubsystem->ReleaseInstance(GetClass(), RenderInstanceIndex);
+	}
+
+	RenderInstanceComponent = nullptr;
+	RenderInstanceIndex = INDEX_NONE;
+}
+
+void ABaseItem::OnItemOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+{
+	INC_DWORD_STAT(STAT_Sparta_ItemOverlapEvents);
+
+	// 채널 설정으로 플레이어 캡슐만 걸러지므로 여기서는 조종 중인 폰인지만 확인
+	if (IsPlayerPawn(OtherActor))
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Sparta_ActivateItem);
+		TRACE_CPUPROFILER_EVENT_SCOPE(ABaseItem::ActivateItem);
+
+		// 아이템 사용 (획득) 로직 호출
+		ActivateItem(OtherActor);
+	}
+}
+
+void ABaseItem::OnItemEndOverlap(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+{
+}
+
+void ABaseItem::ActivateItem(AActor* Activator)
+{
+	if (ASpartaGameState* GameState = GetWorld()->GetGameState<ASpartaGameState>())
+	{
+		GameState->RecordPickup();
+	}
+
+	PlayPickupFeedback(GetWorld(), GetActorLocation(), GetActorRotation());
+}
+
+void ABaseItem::PlayPickupFeedback(UWorld* World, const FVector& Location, const FRotator& Rotation) const
+{
+	// 풀링된 컴포넌트로 재생하고, 2초 뒤 비활성화는 이펙트 서브시스템이 일괄 처리
+	if (UItemEffectSubsystem* EffectSubsystem = World->GetSubsystem<UItemEffectSubsystem>())
+	{
+		// Niagara 이펙트가 있으면 우선 사용하고, 없으면 기존 Cascade 파티클 사용
+		UFXSystemAsset* Effect = PickupParticle.Get();
+		if (PickupEffect)
+		{
+			Effect = PickupEffect.Get();
+		}
+		EffectSubsystem->SpawnEffect(Effect, Location, Rotation, 2.0f);
+	}
+
+	// 연달아 주운 픽업은 하나의 사운드로 합쳐서 재생
+	if (UPickupAudioSubsystem* AudioSubsystem = World->GetSubsystem<UPickupAudioSubsystem>())
+	{
+		AudioSubsystem->PlayPickupSound(PickupSound, ItemType, Location, PickupSoundConcurrency);
+	}
+}
+
+bool ABaseItem::IsPlayerPawn(const AActor* Actor)
+{
+	const APawn* Pawn = Cast<APawn>(Actor);
+	return Pawn && Pawn->IsPlayerControlled();
+}
+
+FName ABaseItem::GetItemType() const
+{
+	return ItemType;
+}
+
+void ABaseItem::DestroyItem()
+{
+	// SpawnVolume이 스폰한 아이템은 파괴하지 않고 풀로 반환
+	if (ASpawnVolume* OwningVolume = Cast<ASpawnVolume>(GetOwner()))
+	{
+		OwningVolume->ReleaseItem(this);
+		return;
+	}
+
+	Destroy();
+}
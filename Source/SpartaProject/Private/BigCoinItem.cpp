@@ -1,14 +1,14 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "BigCoinItem.h"
-
-ABigCoinItem::ABigCoinItem()
-{
-	PointValue = 50;
-	ItemType = "BigCoin";
-}
-
-void ABigCoinItem::ActivateItem(AActor* Activator)
-{
-	Super::ActivateItem(Activator);
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "BigCoinItem.h"
+
+ABigCoinItem::ABigCoinItem()
+{
+	PointValue = 50;
+	ItemType = "BigCoin";
+}
+
+void ABigCoinItem::ActivateItem(AActor* Activator)
+{
+	Super::ActivateItem(Activator);
+}
@@ -1,29 +1,29 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "CoinItem.h"
-#include "Engine/World.h"
-#include "SpartaGameState.h"
-
-ACoinItem::ACoinItem()
-{
-	PointValue = 0;
-	ItemType = "DefaultCoin";
-}
-
-void ACoinItem::ActivateItem(AActor* Activator)
-{
-	Super::ActivateItem(Activator);
-	// 플레이어 태그 확인
-	if (Activator && Activator->ActorHasTag("Player"))
-	{
-		if (UWorld* World = GetWorld())
-		{
-			if (ASpartaGameState* GameState = World->GetGameState<ASpartaGameState>())
-			{
-				GameState->AddScore(PointValue);
-				GameState->OnCoinCollected();
-			}
-		}
-		DestroyItem();
-	}
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CoinItem.h"
+#include "Engine/World.h"
+#include "SpartaGameState.h"
+
+ACoinItem::ACoinItem()
+{
+	PointValue = 0;
+	ItemType = "DefaultCoin";
+}
+
+void ACoinItem::ActivateItem(AActor* Activator)
+{
+	Super::ActivateItem(Activator);
+	// 플레이어가 조종하는 폰인지 확인
+	if (IsPlayerPawn(Activator))
+	{
+		if (UWorld* World = GetWorld())
+		{
+			if (ASpartaGameState* GameState = World->GetGameState<ASpartaGameState>())
+			{
+				GameState->AddScore(PointValue);
+				GameState->OnCoinCollected();
+			}
+		}
+		DestroyItem();
+	}
+}
@@ -1,24 +1,24 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "HealingItem.h"
-#include "SpartaCharacter.h"
-
-AHealingItem::AHealingItem()
-{
-	HealAmount = 20.f;
-	ItemType = "Healing";
-}
-
-void AHealingItem::ActivateItem(AActor* Activator)
-{
-	Super::ActivateItem(Activator);
-	if (Activator && Activator->ActorHasTag("Player"))
-	{
-		if (ASpartaCharacter* PlayerCharacter = Cast<ASpartaCharacter>(Activator))
-		{
-			PlayerCharacter->AddHealth(HealAmount);
-		}
-
-		DestroyItem();
-	}
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "HealingItem.h"
+#include "SpartaCharacter.h"
+
+AHealingItem::AHealingItem()
+{
+	HealAmount = 20.f;
+	ItemType = "Healing";
+}
+
+void AHealingItem::ActivateItem(AActor* Activator)
+{
+	Super::ActivateItem(Activator);
+	if (IsPlayerPawn(Activator))
+	{
+		if (ASpartaCharacter* PlayerCharacter = Cast<ASpartaCharacter>(Activator))
+		{
+			PlayerCharacter->AddHealth(HealAmount);
+		}
+
+		DestroyItem();
+	}
+}
@@ -1,32 +1,32 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "Item.h"
-
-// "LogSparta" 카테고리 정의 (헤더에서 선언한 것을 실제로 구현)
-DEFINE_LOG_CATEGORY(LogSparta);
-
-AItem::AItem()
-{
-	PrimaryActorTick.bCanEverTick = false;
-	// Scene Component를 생성하고 루트로 설정
-	SceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
-	SetRootComponent(SceneRoot);
-
-	// Static Mesh Component를 생성하고 Scene Component에 Attach
-	StaticMeshComp = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMesh"));
-	StaticMeshComp->SetupAttachment(SceneRoot);
-
-	// Static Mesh를 코드에서 설정
-	static ConstructorHelpers::FObjectFinder<UStaticMesh> MeshAsset(TEXT("/Game/Resources/Props/SM_Chair.SM_Chair"));
-	if (MeshAsset.Succeeded())
-	{
-		StaticMeshComp->SetStaticMesh(MeshAsset.Object);
-	}
-
-	static ConstructorHelpers::FObjectFinder<UMaterial> MaterialAsset(
-		TEXT("/Game/Resources/Materials/M_Metal_Gold.M_Metal_Gold"));
-	if (MaterialAsset.Succeeded())
-	{
-		StaticMeshComp->SetMaterial(0, MaterialAsset.Object);
-	}
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Item.h"
+
+// "LogSparta" 카테고리 정의 (헤더에서 선언한 것을 실제로 구현)
+DEFINE_LOG_CATEGORY(LogSparta);
+
+AItem::AItem()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	// Scene Component를 생성하고 루트로 설정
+	SceneRoot = CreateDefaultSubobject<USceneComponent>(TEXT("SceneRoot"));
+	SetRootComponent(SceneRoot);
+
+	// Static Mesh Component를 생성하고 Scene Component에 Attach
+	StaticMeshComp = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("StaticMesh"));
+	StaticMeshComp->SetupAttachment(SceneRoot);
+
+	// Static Mesh를 코드에서 설정
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> MeshAsset(TEXT("/Game/Resources/Props/SM_Chair.SM_Chair"));
+	if (MeshAsset.Succeeded())
+	{
+		StaticMeshComp->SetStaticMesh(MeshAsset.Object);
+	}
+
+	static ConstructorHelpers::FObjectFinder<UMaterial> MaterialAsset(
+		TEXT("/Game/Resources/Materials/M_Metal_Gold.M_Metal_Gold"));
+	if (MaterialAsset.Succeeded())
+	{
+		StaticMeshComp->SetMaterial(0, MaterialAsset.Object);
+	}
+}
@@ -0,0 +1,262 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemAnimationSubsystem.h"
+#include "BaseItem.h"
+#include "SpartaStats.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	TAutoConsoleVariable<bool> CVarItemSignificanceEnabled(
+		TEXT("Sparta.ItemLOD.Enabled"),
+		true,
+		TEXT("멀리 있는 아이템의 움직임/그림자/충돌을 줄일지 여부"));
+
+	TAutoConsoleVariable<float> CVarItemNearScreenSize(
+		TEXT("Sparta.ItemLOD.NearScreenSize"),
+		0.02f,
+		TEXT("경계 구 반지름 / 거리가 이 값 이상이면 Near (매 프레임 갱신)"));
+
+	TAutoConsoleVariable<float> CVarItemFarScreenSize(
+		TEXT("Sparta.ItemLOD.FarScreenSize"),
+		0.008f,
+		TEXT("경계 구 반지름 / 거리가 이 값 미만이면 Far (움직임 정지)"));
+
+	TAutoConsoleVariable<int32> CVarItemMidUpdateInterval(
+		TEXT("Sparta.ItemLOD.MidUpdateInterval"),
+		4,
+		TEXT("Mid 아이템의 트랜스폼을 몇 프레임마다 반영할지"));
+
+	TAutoConsoleVariable<float> CVarItemFarCullDistance(
+		TEXT("Sparta.ItemLOD.FarCullDistance"),
+		8000.f,
+		TEXT("Far 아이템 메시에 적용할 컬 거리"));
+
+	// 중요도 재계산 주기 (초)
+	constexpr float SignificanceUpdateInterval = 0.25f;
+}
+
+void UItemAnimationSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_ItemTick);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UItemAnimationSubsystem::Tick);
+
+	Super::Tick(DeltaTime);
+
+	const int32 Count = Items.Num();
+	if (Count == 0)
+		return;
+
+	ElapsedTime += DeltaTime;
+	FrameCounter++;
+
+	// 중요도는 플레이어가 크게 움직일 수 있는 주기보다 짧게만 갱신하면 되므로 매 프레임 계산하지 않음
+	TimeSinceSignificanceUpdate += DeltaTime;
+	if (TimeSinceSignificanceUpdate >= SignificanceUpdateInterval)
+	{
+		TimeSinceSignificanceUpdate = 0.f;
+		UpdateSignificance();
+	}
+
+	// 1) 회전 갱신 - 분기 없는 연속 배열 연산이라 컴파일러가 SIMD로 묶을 수 있음
+	// 멈춘 아이템도 각도는 계속 진행시켜 다시 가까워졌을 때 자연스럽게 이어지도록
+	float* RESTRICT YawData = Yaws.GetData();
+	const float* RESTRICT YawSpeedData = YawSpeeds.GetData();
+	for (int32 i = 0; i < Count; i++)
+	{
+		const float Yaw = YawData[i] + YawSpeedData[i] * DeltaTime;
+		YawData[i] = Yaw - 360.f * FMath::FloorToFloat(Yaw / 360.f);
+	}
+
+	// 2) 상하 오프셋 계산
+	float* RESTRICT OffsetData = BobOffsets.GetData();
+	const float* RESTRICT AmplitudeData = BobAmplitudes.GetData();
+	const float* RESTRICT AngularSpeedData = BobAngularSpeeds.GetData();
+	const float* RESTRICT PhaseData = BobPhases.GetData();
+	for (int32 i = 0; i < Count; i++)
+	{
+		OffsetData[i] = AmplitudeData[i] * FMath::Sin(ElapsedTime * AngularSpeedData[i] + PhaseData[i]);
+	}
+
+	// 3) 계산된 결과를 한 번에 반영 (비용 대부분이 여기이므로 중요도가 낮은 아이템은 건너뜀)
+	const uint32 MidUpdateInterval = static_cast<uint32>(FMath::Max(CVarItemMidUpdateInterval.GetValueOnGameThread(), 1));
+	for (int32 i = 0; i < Count; i++)
+	{
+		const EItemSignificance Significance = Significances[i];
+		if (Significance == EItemSignificance::Far)
+			continue;
+		// Mid 아이템은 슬롯별로 프레임을 나눠 갱신해서 특정 프레임에 몰리지 않도록
+		if (Significance == EItemSignificance::Mid && (FrameCounter + static_cast<uint32>(i)) % MidUpdateInterval != 0)
+			continue;
+
+		const FVector Location = BaseLocations[i] + FVector(0.f, 0.f, OffsetData[i]);
+		const FRotator Rotation(Pitches[i], YawData[i], Rolls[i]);
+
+		// 인스턴스 렌더링 아이템은 액터를 움직이지 않고, 컴포넌트별로 모아 루프가 끝난 뒤 한 번에 갱신
+		if (UInstancedStaticMeshComponent* InstanceComponent = InstanceComponents[i])
+		{
+			InstanceTransformBatcher.Add(InstanceComponent, InstanceIndices[i], MeshOffsets[i] * FTransform(Rotation, Location));
+			continue;
+		}
+
+		// 물리/Overlap 갱신 없이 트랜스폼만 밀어넣어 개별 SetActorRotation보다 가볍게 처리
+		if (USceneComponent* Root = Roots[i])
+		{
+			Root->SetWorldLocationAndRotationNoPhysics(Location, Rotation);
+		}
+	}
+
+	InstanceTransformBatcher.Flush();
+}
+
+void UItemAnimationSubsystem::UpdateSignificance()
+{
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController)
+		return;
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const bool bEnabled = CVarItemSignificanceEnabled.GetValueOnGameThread();
+	const float NearScreenSize = CVarItemNearScreenSize.GetValueOnGameThread();
+	const float FarScreenSize = CVarItemFarScreenSize.GetValueOnGameThread();
+
+	int32 NumMid = 0;
+	int32 NumFar = 0;
+	for (int32 i = 0; i < Items.Num(); i++)
+	{
+		EItemSignificance NewSignificance = EItemSignificance::Near;
+		if (bEnabled)
+		{
+			// 경계 구 반지름 / 거리로 화면에서 차지하는 크기를 근사 (큰 아이템은 멀리서도 Near 유지)
+			const float Distance = FMath::Max(FVector::Dist(BaseLocations[i], ViewLocation), 1.f);
+			const float ScreenSize = BoundsRadii[i] / Distance;
+			if (ScreenSize < FarScreenSize)
+			{
+				NewSignificance = EItemSignificance::Far;
+			}
+			else if (ScreenSize < NearScreenSize)
+			{
+				NewSignificance = EItemSignificance::Mid;
+			}
+		}
+
+		// 설정 변경은 버킷이 바뀔 때만
+		if (NewSignificance != Significances[i])
+		{
+			ApplySignificance(i, NewSignificance);
+		}
+
+		NumMid += NewSignificance == EItemSignificance::Mid;
+		NumFar += NewSignificance == EItemSignificance::Far;
+	}
+
+	SET_DWORD_STAT(STAT_Sparta_MidSignificanceItems, NumMid);
+	SET_DWORD_STAT(STAT_Sparta_FarSignificanceItems, NumFar);
+}
+
+void UItemAnimationSubsystem::ApplySignificance(int32 Slot, EItemSignificance NewSignificance)
+{
+	ABaseItem* Item = Items[Slot];
+	Significances[Slot] = NewSignificance;
+
+	// 인스턴스 렌더링 아이템은 메시가 숨겨져 있고 그림자/컬 거리는 공유 컴포넌트 설정을 따름
+	if (!InstanceComponents[Slot])
+	{
+		UStaticMeshComponent* Mesh = Item->StaticMesh;
+		Mesh->SetCastShadow(NewSignificance == EItemSignificance::Near && DefaultCastShadows[Slot]);
+		Mesh->SetCullDistance(NewSignificance == EItemSignificance::Far ? CVarItemFarCullDistance.GetValueOnGameThread() : DefaultDrawDistances[Slot]);
+	}
+
+	// Overlap으로 픽업하는 아이템은 멀리 있는 동안 물리 씬에서 빼둠 (격자 픽업 아이템은 원래 충돌이 꺼져 있음)
+	if (!Item->bUseProximityPickup)
+	{
+		Item->Collision->SetCollisionEnabled(NewSignificance == EItemSignificance::Far ? ECollisionEnabled::NoCollision : DefaultCollisionEnabled[Slot]);
+	}
+}
+
+TStatId UItemAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemAnimationSubsystem, STATGROUP_Tickables);
+}
+
+void UItemAnimationSubsystem::RegisterItem(ABaseItem* Item)
+{
+	if (!Item || Item->AnimationSlot != INDEX_NONE)
+		return;
+
+	const FRotator Rotation = Item->GetActorRotation();
+
+	Item->AnimationSlot = Items.Add(Item);
+	Roots.Add(Item->GetRootComponent());
+	BaseLocations.Add(Item->GetActorLocation());
+	Pitches.Add(Rotation.Pitch);
+	Yaws.Add(Rotation.Yaw);
+	Rolls.Add(Rotation.Roll);
+	YawSpeeds.Add(Item->RotationSpeed);
+	BobAmplitudes.Add(Item->BobAmplitude);
+	BobAngularSpeeds.Add(Item->BobFrequency * UE_TWO_PI);
+	// 같은 시점에 스폰된 아이템들이 똑같이 움직이지 않도록 위치 기반으로 위상 분산
+	BobPhases.Add(FMath::Fmod(FMath::Abs(Item->GetActorLocation().X + Item->GetActorLocation().Y) * 0.01f, UE_TWO_PI));
+	BobOffsets.Add(0.f);
+	InstanceComponents.Add(Item->RenderInstanceComponent);
+	InstanceIndices.Add(Item->RenderInstanceIndex);
+	MeshOffsets.Add(Item->StaticMesh->GetComponentTransform().GetRelativeTransform(Item->GetActorTransform()));
+	// 다음 중요도 계산 전까지는 지금처럼 매 프레임 갱신
+	Significances.Add(EItemSignificance::Near);
+	BoundsRadii.Add(FMath::Max(Item->StaticMesh->Bounds.SphereRadius, 1.f));
+	DefaultCastShadows.Add(Item->StaticMesh->CastShadow);
+	DefaultDrawDistances.Add(Item->StaticMesh->LDMaxDrawDistance);
+	DefaultCollisionEnabled.Add(Item->Collision->GetCollisionEnabled());
+}
+
+void UItemAnimationSubsystem::UnregisterItem(ABaseItem* Item)
+{
+	if (!Item || !Items.IsValidIndex(Item->AnimationSlot) || Items[Item->AnimationSlot] != Item)
+		return;
+
+	// 마지막 아이템을 빈 자리로 옮겨 배열을 연속적으로 유지
+	const int32 Slot = Item->AnimationSlot;
+
+	// 풀에서 다시 꺼냈을 때 원래 설정으로 시작하도록 복원
+	if (Significances[Slot] != EItemSignificance::Near)
+	{
+		ApplySignificance(Slot, EItemSignificance::Near);
+	}
+
+	Items.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Roots.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BaseLocations.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Pitches.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Yaws.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Rolls.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	YawSpeeds.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BobAmplitudes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BobAngularSpeeds.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BobPhases.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BobOffsets.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	InstanceComponents.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	InstanceIndices.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	MeshOffsets.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Significances.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BoundsRadii.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	DefaultCastShadows.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	DefaultDrawDistances.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	DefaultCollisionEnabled.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+	if (Items.IsValidIndex(Slot))
+	{
+		Items[Slot]->AnimationSlot = Slot;
+	}
+	Item->AnimationSlot = INDEX_NONE;
+}
+
+bool UItemAnimationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,162 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemEffectSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "NiagaraSystem.h"
+#include "NiagaraComponent.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarItemFXMaxConcurrentPerEffect(
+		TEXT("Sparta.ItemFX.MaxConcurrentPerEffect"),
+		8,
+		TEXT("이펙트 하나당 동시에 재생될 수 있는 최대 개수"));
+
+	TAutoConsoleVariable<float> CVarItemFXMaxLifetime(
+		TEXT("Sparta.ItemFX.MaxLifetime"),
+		2.f,
+		TEXT("이 시간(초)이 지나면 반복 재생 이펙트라도 비활성화해서 풀로 반환"));
+}
+
+void UItemEffectSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (TPair<TObjectKey<UFXSystemAsset>, FActiveEffects>& Pair : ActiveEffects)
+	{
+		PruneEffects(Pair.Value, Now, true);
+	}
+}
+
+TStatId UItemEffectSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemEffectSubsystem, STATGROUP_Tickables);
+}
+
+void UItemEffectSubsystem::SpawnEffect(UFXSystemAsset* Effect, const FVector& Location, const FRotator& Rotation, float TimeDilation)
+{
+	if (!Effect)
+		return;
+
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+
+	const int32 MaxConcurrentPerEffect = FMath::Max(CVarItemFXMaxConcurrentPerEffect.GetValueOnGameThread(), 0);
+
+	FActiveEffects& Active = ActiveEffects.FindOrAdd(Effect);
+	if (Active.Components.Max() < MaxConcurrentPerEffect)
+	{
+		Active.Components.Reserve(MaxConcurrentPerEffect);
+		Active.StartTimes.Reserve(MaxConcurrentPerEffect);
+	}
+	PruneEffects(Active, Now, false);
+
+	// 같은 이펙트가 이미 예산만큼 재생 중이면 새로 만들지 않음 (몰아서 먹어도 화면상 차이가 거의 없음)
+	if (Active.Components.Num() >= MaxConcurrentPerEffect)
+		return;
+
+	UFXSystemComponent* Component = nullptr;
+
+	if (UNiagaraSystem* NiagaraSystem = Cast<UNiagaraSystem>(Effect))
+	{
+		UNiagaraComponent* Niagara = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+			World,
+			NiagaraSystem,
+			Location,
+			Rotation,
+			FVector::OneVector,
+			false,
+			true,
+			ENCPoolMethod::AutoRelease);
+
+		if (Niagara)
+		{
+			Niagara->OnSystemFinished.AddUniqueDynamic(this, &UItemEffectSubsystem::OnNiagaraFinished);
+		}
+		Component = Niagara;
+	}
+	else if (UParticleSystem* ParticleSystem = Cast<UParticleSystem>(Effect))
+	{
+		UParticleSystemComponent* Particle = UGameplayStatics::SpawnEmitterAtLocation(
+			World,
+			ParticleSystem,
+			FTransform(Rotation, Location),
+			false,
+			EPSCPoolMethod::AutoRelease);
+
+		if (Particle)
+		{
+			Particle->CustomTimeDilation = TimeDilation;
+			Particle->OnSystemFinished.AddUniqueDynamic(this, &UItemEffectSubsystem::OnParticleFinished);
+		}
+		Component = Particle;
+	}
+
+	if (Component)
+	{
+		Active.Components.Add(Component);
+		Active.StartTimes.Add(Now);
+	}
+}
+
+bool UItemEffectSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UItemEffectSubsystem::PruneEffects(FActiveEffects& Active, double Now, bool bDeactivateExpired)
+{
+	const float MaxEffectLifetime = CVarItemFXMaxLifetime.GetValueOnGameThread();
+
+	for (int32 i = Active.Components.Num() - 1; i >= 0; i--)
+	{
+		UFXSystemComponent* Component = Active.Components[i].Get();
+		const bool bExpired = Now - Active.StartTimes[i] >= MaxEffectLifetime;
+
+		// 재생 중인 이펙트는 수명이 다했고 비활성화가 허용된 경우에만 정리
+		if (Component && Component->IsActive() && (!bExpired || !bDeactivateExpired))
+			continue;
+
+		// 비활성화 중에 끝남 콜백이 불릴 수 있으므로 목록에서 먼저 제거
+		Active.Components.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		Active.StartTimes.RemoveAtSwap(i, 1, EAllowShrinking::No);
+
+		// 목록에 남아 있던 컴포넌트는 아직 끝나지 않은 우리 이펙트이므로 비활성화해도 안전 (AutoRelease로 풀에 반환됨)
+		if (Component && Component->IsActive())
+		{
+			Component->Deactivate();
+		}
+	}
+}
+
+void UItemEffectSubsystem::OnNiagaraFinished(UNiagaraComponent* Component)
+{
+	RemoveEffectComponent(Component);
+}
+
+void UItemEffectSubsystem::OnParticleFinished(UParticleSystemComponent* Component)
+{
+	RemoveEffectComponent(Component);
+}
+
+void UItemEffectSubsystem::RemoveEffectComponent(UFXSystemComponent* Component)
+{
+	if (!Component)
+		return;
+
+	FActiveEffects* Active = ActiveEffects.Find(Component->GetFXSystemAsset());
+	if (!Active)
+		return;
+
+	const int32 Index = Active->Components.IndexOfByKey(Component);
+	if (Index != INDEX_NONE)
+	{
+		Active->Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Active->StartTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+}
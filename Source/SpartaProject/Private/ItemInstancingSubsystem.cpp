@@ -0,0 +1,154 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemInstancingSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+
+namespace
+{
+	// 반환된 인스턴스는 크기 0으로 만들어 화면에서 숨김
+	const FTransform HiddenInstanceTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+}
+
+void FItemInstanceTransformBatcher::Add(UInstancedStaticMeshComponent* Component, int32 InstanceIndex, const FTransform& WorldTransform)
+{
+	PendingUpdates.FindOrAdd(Component).Add({ InstanceIndex, WorldTransform });
+}
+
+void FItemInstanceTransformBatcher::Flush()
+{
+	for (TPair<UInstancedStaticMeshComponent*, TArray<FPendingUpdate>>& Pair : PendingUpdates)
+	{
+		UInstancedStaticMeshComponent* Component = Pair.Key;
+		if (!IsValid(Component))
+			continue;
+
+		const int32 NumInstances = Component->GetInstanceCount();
+		int32 MinIndex = MAX_int32;
+		int32 MaxIndex = INDEX_NONE;
+		for (const FPendingUpdate& Update : Pair.Value)
+		{
+			if (Update.InstanceIndex >= 0 && Update.InstanceIndex < NumInstances)
+			{
+				MinIndex = FMath::Min(MinIndex, Update.InstanceIndex);
+				MaxIndex = FMath::Max(MaxIndex, Update.InstanceIndex);
+			}
+		}
+		if (MaxIndex == INDEX_NONE)
+			continue;
+
+		// 범위 안에서 이번에 바뀌지 않은 인스턴스(멀리 있어 건너뛴 아이템, 숨겨둔 빈 슬롯)는 현재 값을 그대로 다시 씀
+		RangeTransforms.SetNum(MaxIndex - MinIndex + 1, EAllowShrinking::No);
+		for (int32 InstanceIndex = MinIndex; InstanceIndex <= MaxIndex; InstanceIndex++)
+		{
+			Component->GetInstanceTransform(InstanceIndex, RangeTransforms[InstanceIndex - MinIndex], true);
+		}
+		for (const FPendingUpdate& Update : Pair.Value)
+		{
+			if (Update.InstanceIndex >= MinIndex && Update.InstanceIndex <= MaxIndex)
+			{
+				RangeTransforms[Update.InstanceIndex - MinIndex] = Update.WorldTransform;
+			}
+		}
+
+		Component->BatchUpdateInstancesTransforms(MinIndex, RangeTransforms, true, true, true);
+	}
+
+	PendingUpdates.Reset();
+}
+
+void UItemInstancingSubsystem::Deinitialize()
+{
+	Batches.Empty();
+	InstanceHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UItemInstancingSubsystem::AcquireInstance(UClass* ItemClass, const UStaticMeshComponent* SourceMesh, const FTransform& WorldTransform,
+	UInstancedStaticMeshComponent*& OutComponent, int32& OutInstanceIndex)
+{
+	OutComponent = nullptr;
+	OutInstanceIndex = INDEX_NONE;
+
+	if (!ItemClass || !SourceMesh || !SourceMesh->GetStaticMesh())
+		return false;
+
+	FItemInstanceBatch& Batch = Batches.FindOrAdd(ItemClass);
+	if (!Batch.Component)
+	{
+		Batch.Component = CreateInstanceComponent(SourceMesh);
+		if (!Batch.Component)
+			return false;
+	}
+
+	if (Batch.FreeIndices.Num() > 0)
+	{
+		// 숨겨둔 인스턴스를 다시 사용
+		OutInstanceIndex = Batch.FreeIndices.Pop(EAllowShrinking::No);
+		Batch.Component->UpdateInstanceTransform(OutInstanceIndex, WorldTransform, true, true, true);
+	}
+	else
+	{
+		OutInstanceIndex = Batch.Component->AddInstance(WorldTransform, true);
+	}
+
+	OutComponent = Batch.Component;
+	NumActiveInstances++;
+	return true;
+}
+
+void UItemInstancingSubsystem::ReleaseInstance(UClass* ItemClass, int32 InstanceIndex)
+{
+	FItemInstanceBatch* Batch = Batches.Find(ItemClass);
+	if (!Batch || !Batch->Component || InstanceIndex == INDEX_NONE)
+		return;
+
+	Batch->Component->UpdateInstanceTransform(InstanceIndex, HiddenInstanceTransform, true, true, true);
+	Batch->FreeIndices.Add(InstanceIndex);
+	NumActiveInstances--;
+}
+
+bool UItemInstancingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UInstancedStaticMeshComponent* UItemInstancingSubsystem::CreateInstanceComponent(const UStaticMeshComponent* SourceMesh)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return nullptr;
+
+	if (!InstanceHost)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.Name = TEXT("ItemInstanceHost");
+		SpawnParams.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+		SpawnParams.ObjectFlags = RF_Transient;
+		InstanceHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!InstanceHost)
+			return nullptr;
+	}
+
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(InstanceHost);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetStaticMesh(SourceMesh->GetStaticMesh());
+	for (int32 MaterialIndex = 0; MaterialIndex < SourceMesh->GetNumMaterials(); MaterialIndex++)
+	{
+		Component->SetMaterial(MaterialIndex, SourceMesh->GetMaterial(MaterialIndex));
+	}
+	Component->SetCastShadow(SourceMesh->CastShadow);
+	// 픽업 판정은 아이템 액터의 Collision이 담당하므로 인스턴스에는 충돌 불필요
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetCanEverAffectNavigation(false);
+
+	if (!InstanceHost->GetRootComponent())
+	{
+		InstanceHost->SetRootComponent(Component);
+	}
+	InstanceHost->AddInstanceComponent(Component);
+	Component->RegisterComponent();
+
+	return Component;
+}
@@ -1,5 +1,5 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "ItemInterface.h"
-
-// Add default functionality here for any IItemInterface functions that are not pure virtual.
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemInterface.h"
+
+// Add default functionality here for any IItemInterface functions that are not pure virtual.
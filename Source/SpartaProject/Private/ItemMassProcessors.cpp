@@ -0,0 +1,172 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemMassProcessors.h"
+#include "ItemMassTypes.h"
+#include "MassExecutionContext.h"
+#include "Components/InstancedStaticMeshComponent.h"
+
+UItemMassAnimationProcessor::UItemMassAnimationProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UItemMassAnimationProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FItemMassSpinFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FItemMassLocationFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FItemMassRenderFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+void UItemMassAnimationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassAnimationProcessor::Execute);
+
+	EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, [this](FMassExecutionContext& ChunkContext)
+	{
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+		const TArrayView<FItemMassSpinFragment> Spins = ChunkContext.GetMutableFragmentView<FItemMassSpinFragment>();
+		const TConstArrayView<FItemMassLocationFragment> Locations = ChunkContext.GetFragmentView<FItemMassLocationFragment>();
+		const TArrayView<FItemMassRenderFragment> Renders = ChunkContext.GetMutableFragmentView<FItemMassRenderFragment>();
+
+		for (int32 i = 0; i < ChunkContext.GetNumEntities(); i++)
+		{
+			FItemMassSpinFragment& Spin = Spins[i];
+			const float Yaw = Spin.Yaw + Spin.YawSpeed * DeltaTime;
+			Spin.Yaw = Yaw - 360.f * FMath::FloorToFloat(Yaw / 360.f);
+
+			const float BobOffset = Spin.BobAmplitude * FMath::Sin(ElapsedTime * Spin.BobAngularSpeed + Spin.BobPhase);
+			const FVector Location = Locations[i].BaseLocation + FVector(0.f, 0.f, BobOffset);
+
+			FItemMassRenderFragment& Render = Renders[i];
+			Render.InstanceTransform = Render.MeshOffset * FTransform(FRotator(Spin.Pitch, Spin.Yaw, Spin.Roll), Location);
+		}
+	});
+}
+
+UItemMassPickupProcessor::UItemMassPickupProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UItemMassPickupProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FItemMassLocationFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FItemMassTypeFragment>(EMassFragmentAccess::ReadOnly);
+	// 이미 밟힌 지뢰는 폭발할 때까지 다시 판정하지 않음
+	EntityQuery.AddTagRequirement<FItemMassArmedTag>(EMassFragmentPresence::None);
+}
+
+void UItemMassPickupProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassPickupProcessor::Execute);
+
+	Pickups.Reset();
+	if (Players.Num() == 0)
+		return;
+
+	EntityQuery.ParallelForEachEntityChunk(EntityManager, Context, [this](FMassExecutionContext& ChunkContext)
+	{
+		const TConstArrayView<FItemMassLocationFragment> Locations = ChunkContext.GetFragmentView<FItemMassLocationFragment>();
+
+		// 청크 안에서 모은 뒤 한 번만 잠금
+		TArray<TPair<FMassEntityHandle, int32>, TInlineAllocator<8>> ChunkPickups;
+		for (int32 i = 0; i < ChunkContext.GetNumEntities(); i++)
+		{
+			const FItemMassLocationFragment& Location = Locations[i];
+			for (int32 PlayerIndex = 0; PlayerIndex < Players.Num(); PlayerIndex++)
+			{
+				// UItemProximitySubsystem과 같은 원기둥 대 구 판정
+				const FPlayerCylinder& Player = Players[PlayerIndex];
+				const FVector Delta = Location.BaseLocation - Player.Location;
+				if (Delta.SizeSquared2D() <= FMath::Square(Player.Radius + Location.PickupRadius)
+					&& FMath::Abs(Delta.Z) <= Player.HalfHeight + Location.PickupRadius)
+				{
+					ChunkPickups.Emplace(ChunkContext.GetEntity(i), PlayerIndex);
+					break;
+				}
+			}
+		}
+
+		if (ChunkPickups.Num() > 0)
+		{
+			FScopeLock Lock(&PickupsLock);
+			Pickups.Append(ChunkPickups);
+		}
+	});
+}
+
+UItemMassFuseProcessor::UItemMassFuseProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UItemMassFuseProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FItemMassFuseFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddTagRequirement<FItemMassArmedTag>(EMassFragmentPresence::All);
+}
+
+void UItemMassFuseProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassFuseProcessor::Execute);
+
+	Detonations.Reset();
+
+	// 밟힌 지뢰는 많지 않으므로 병렬 처리하지 않음
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [this](FMassExecutionContext& ChunkContext)
+	{
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+		const TArrayView<FItemMassFuseFragment> Fuses = ChunkContext.GetMutableFragmentView<FItemMassFuseFragment>();
+
+		for (int32 i = 0; i < ChunkContext.GetNumEntities(); i++)
+		{
+			FItemMassFuseFragment& Fuse = Fuses[i];
+			Fuse.RemainingTime -= DeltaTime;
+			if (Fuse.RemainingTime <= 0.f)
+			{
+				Detonations.Add(ChunkContext.GetEntity(i));
+			}
+		}
+	});
+}
+
+UItemMassRenderProcessor::UItemMassRenderProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	bRequiresGameThreadExecution = true;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UItemMassRenderProcessor::ConfigureQueries()
+{
+	EntityQuery.AddRequirement<FItemMassRenderFragment>(EMassFragmentAccess::ReadOnly);
+}
+
+void UItemMassRenderProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassRenderProcessor::Execute);
+
+	// 인스턴스마다 갱신하지 않고 컴포넌트별로 모아 프레임당 한 번씩 반영
+	FItemInstanceTransformBatcher& Batcher = TransformBatcher;
+	EntityQuery.ForEachEntityChunk(EntityManager, Context, [&Batcher](FMassExecutionContext& ChunkContext)
+	{
+		const TConstArrayView<FItemMassRenderFragment> Renders = ChunkContext.GetFragmentView<FItemMassRenderFragment>();
+
+		for (int32 i = 0; i < ChunkContext.GetNumEntities(); i++)
+		{
+			const FItemMassRenderFragment& Render = Renders[i];
+			if (!Render.Component)
+				continue;
+
+			Batcher.Add(Render.Component, Render.InstanceIndex, Render.InstanceTransform);
+		}
+	});
+	Batcher.Flush();
+}
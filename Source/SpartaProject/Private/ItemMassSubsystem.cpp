@@ -0,0 +1,377 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemMassSubsystem.h"
+#include "ItemMassProcessors.h"
+#include "ItemInstancingSubsystem.h"
+#include "BaseItem.h"
+#include "CoinItem.h"
+#include "HealingItem.h"
+#include "MineItem.h"
+#include "SpartaCharacter.h"
+#include "SpartaGameState.h"
+#include "SpartaStats.h"
+#include "MassEntitySubsystem.h"
+#include "MassExecutor.h"
+#include "MassProcessingTypes.h"
+#include "Components/SphereComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/DamageType.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+void UItemMassSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Collection.InitializeDependency<UMassEntitySubsystem>();
+
+	AnimationProcessor = NewObject<UItemMassAnimationProcessor>(this);
+	PickupProcessor = NewObject<UItemMassPickupProcessor>(this);
+	FuseProcessor = NewObject<UItemMassFuseProcessor>(this);
+	RenderProcessor = NewObject<UItemMassRenderProcessor>(this);
+
+	AnimationProcessor->CallInitialize(this);
+	PickupProcessor->CallInitialize(this);
+	FuseProcessor->CallInitialize(this);
+	RenderProcessor->CallInitialize(this);
+}
+
+void UItemMassSubsystem::Deinitialize()
+{
+	// 엔티티는 엔티티 매니저와 함께 정리되므로 핸들만 버림
+	LiveEntities.Empty();
+	ClassInfos.Empty();
+	ItemClasses.Empty();
+	SET_DWORD_STAT(STAT_Sparta_MassItems, 0);
+
+	Super::Deinitialize();
+}
+
+void UItemMassSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_MassItemTick);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassSubsystem::Tick);
+
+	Super::Tick(DeltaTime);
+
+	if (LiveEntities.Num() == 0)
+		return;
+
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager)
+		return;
+
+	ElapsedTime += DeltaTime;
+
+	// 픽업 판정에 쓸 플레이어 충돌 원기둥
+	TArray<APawn*> PlayerPawns;
+	PickupProcessor->Players.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!Pawn)
+			continue;
+
+		UItemMassPickupProcessor::FPlayerCylinder& Player = PickupProcessor->Players.AddDefaulted_GetRef();
+		Player.Location = Pawn->GetActorLocation();
+		Pawn->GetSimpleCollisionCylinder(Player.Radius, Player.HalfHeight);
+		PlayerPawns.Add(Pawn);
+	}
+
+	AnimationProcessor->ElapsedTime = ElapsedTime;
+
+	// 움직임 → 픽업 판정 → 지뢰 대기 → 인스턴스 반영 순서로 실행
+	UMassProcessor* Processors[] = { AnimationProcessor.Get(), PickupProcessor.Get(), FuseProcessor.Get(), RenderProcessor.Get() };
+	FMassProcessingContext ProcessingContext(*EntityManager, DeltaTime);
+	UE::Mass::Executor::RunProcessorsView(Processors, ProcessingContext);
+
+	// 엔티티 제거와 점수/회복/데미지 적용은 처리가 끝난 뒤 게임 스레드에서
+	HandlePickups(PlayerPawns);
+	HandleDetonations(PlayerPawns);
+
+	SET_DWORD_STAT(STAT_Sparta_MassItems, LiveEntities.Num());
+}
+
+TStatId UItemMassSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemMassSubsystem, STATGROUP_Tickables);
+}
+
+bool UItemMassSubsystem::UsesMassSimulation(const UClass* ItemClass)
+{
+	const ABaseItem* DefaultItem = ItemClass ? Cast<ABaseItem>(ItemClass->GetDefaultObject()) : nullptr;
+	return DefaultItem && DefaultItem->bUseMassSimulation;
+}
+
+bool UItemMassSubsystem::SpawnItem(UClass* ItemClass, const FVector& Location, const FRotator& Rotation)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	const int32 ClassIndex = FindOrAddClassInfo(ItemClass);
+	if (!EntityManager || ClassIndex == INDEX_NONE)
+		return false;
+
+	const FItemClassInfo& Info = ClassInfos[ClassIndex];
+
+	// 인스턴스를 얻지 못하면 보이지 않으므로 액터로 스폰하도록 실패 처리
+	const FTransform InstanceTransform = Info.MeshOffset * FTransform(Rotation, Location);
+	UInstancedStaticMeshComponent* InstanceComponent = nullptr;
+	int32 InstanceIndex = INDEX_NONE;
+	UItemInstancingSubsystem* InstancingSubsystem = GetWorld()->GetSubsystem<UItemInstancingSubsystem>();
+	if (!InstancingSubsystem
+		|| !InstancingSubsystem->AcquireInstance(ItemClass, Info.DefaultItem->StaticMesh, InstanceTransform, InstanceComponent, InstanceIndex))
+		return false;
+
+	const FMassEntityHandle Entity = EntityManager->CreateEntity(Info.Archetype);
+
+	FItemMassTypeFragment& Type = EntityManager->GetFragmentDataChecked<FItemMassTypeFragment>(Entity);
+	Type.ClassIndex = ClassIndex;
+	Type.Kind = Info.Kind;
+	Type.Value = Info.Value;
+
+	FItemMassLocationFragment& LocationFragment = EntityManager->GetFragmentDataChecked<FItemMassLocationFragment>(Entity);
+	LocationFragment.BaseLocation = Location;
+	LocationFragment.PickupRadius = Info.PickupRadius;
+
+	FItemMassSpinFragment& Spin = EntityManager->GetFragmentDataChecked<FItemMassSpinFragment>(Entity);
+	Spin.Pitch = Rotation.Pitch;
+	Spin.Yaw = Rotation.Yaw;
+	Spin.Roll = Rotation.Roll;
+	Spin.YawSpeed = Info.DefaultItem->RotationSpeed;
+	Spin.BobAmplitude = Info.DefaultItem->BobAmplitude;
+	Spin.BobAngularSpeed = Info.DefaultItem->BobFrequency * UE_TWO_PI;
+	// UItemAnimationSubsystem과 같은 방식으로 위치 기반 위상 분산
+	Spin.BobPhase = FMath::Fmod(FMath::Abs(Location.X + Location.Y) * 0.01f, UE_TWO_PI);
+
+	FItemMassRenderFragment& Render = EntityManager->GetFragmentDataChecked<FItemMassRenderFragment>(Entity);
+	Render.Component = InstanceComponent;
+	Render.InstanceIndex = InstanceIndex;
+	Render.MeshOffset = Info.MeshOffset;
+	Render.InstanceTransform = InstanceTransform;
+
+	if (Info.Kind == EItemMassKind::Mine)
+	{
+		FItemMassFuseFragment& Fuse = EntityManager->GetFragmentDataChecked<FItemMassFuseFragment>(Entity);
+		Fuse.Delay = Info.FuseDelay;
+		Fuse.RemainingTime = Info.FuseDelay;
+		Fuse.Radius = Info.FuseRadius;
+	}
+
+	LiveEntities.Add(Entity);
+	return true;
+}
+
+void UItemMassSubsystem::DestroyAllItems()
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || LiveEntities.Num() == 0)
+		return;
+
+	UItemInstancingSubsystem* InstancingSubsystem = GetWorld()->GetSubsystem<UItemInstancingSubsystem>();
+	TArray<FMassEntityHandle> Entities = LiveEntities.Array();
+	for (const FMassEntityHandle Entity : Entities)
+	{
+		const FItemMassTypeFragment& Type = EntityManager->GetFragmentDataChecked<FItemMassTypeFragment>(Entity);
+		const FItemMassRenderFragment& Render = EntityManager->GetFragmentDataChecked<FItemMassRenderFragment>(Entity);
+		if (InstancingSubsystem)
+		{
+			InstancingSubsystem->ReleaseInstance(ItemClasses[Type.ClassIndex], Render.InstanceIndex);
+		}
+	}
+
+	EntityManager->BatchDestroyEntities(Entities);
+	LiveEntities.Reset();
+	SET_DWORD_STAT(STAT_Sparta_MassItems, 0);
+
+	UE_LOG(LogTemp, Warning, TEXT("[ItemMass] Destroyed %d item entities"), Entities.Num());
+}
+
+bool UItemMassSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UItemMassSubsystem::FindOrAddClassInfo(UClass* ItemClass)
+{
+	const int32 ExistingIndex = ItemClasses.IndexOfByKey(ItemClass);
+	if (ExistingIndex != INDEX_NONE)
+		return ClassInfos[ExistingIndex].bCanSimulate ? ExistingIndex : INDEX_NONE;
+
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !UsesMassSimulation(ItemClass))
+		return INDEX_NONE;
+
+	FItemClassInfo Info;
+	Info.DefaultItem = GetDefault<ABaseItem>(ItemClass);
+
+	TArray<const UScriptStruct*> Fragments = {
+		FItemMassTypeFragment::StaticStruct(),
+		FItemMassLocationFragment::StaticStruct(),
+		FItemMassSpinFragment::StaticStruct(),
+		FItemMassRenderFragment::StaticStruct()
+	};
+
+	// 효과 값은 클래스 기본값에서 읽어 엔티티마다 복사
+	if (const ACoinItem* DefaultCoin = Cast<ACoinItem>(Info.DefaultItem))
+	{
+		Info.Kind = EItemMassKind::Coin;
+		Info.Value = DefaultCoin->PointValue;
+	}
+	else if (const AHealingItem* DefaultHealing = Cast<AHealingItem>(Info.DefaultItem))
+	{
+		Info.Kind = EItemMassKind::Healing;
+		Info.Value = DefaultHealing->HealAmount;
+	}
+	else if (const AMineItem* DefaultMine = Cast<AMineItem>(Info.DefaultItem))
+	{
+		Info.Kind = EItemMassKind::Mine;
+		Info.Value = DefaultMine->ExplosionDamage;
+		Info.FuseDelay = DefaultMine->ExplosionDelay;
+		Info.FuseRadius = DefaultMine->ExplosionRadius;
+		Fragments.Add(FItemMassFuseFragment::StaticStruct());
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ItemMass] %s is not a coin, healing or mine item, spawning as actor"), *ItemClass->GetName());
+		ItemClasses.Add(ItemClass);
+		ClassInfos.Add(Info);
+		return INDEX_NONE;
+	}
+
+	// 인스턴스 메시가 없으면 보이지 않으므로 액터로 스폰
+	const UStaticMeshComponent* DefaultMesh = Info.DefaultItem->StaticMesh;
+	if (!DefaultMesh || !DefaultMesh->GetStaticMesh())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ItemMass] %s has no mesh to instance, spawning as actor"), *ItemClass->GetName());
+		ItemClasses.Add(ItemClass);
+		ClassInfos.Add(Info);
+		return INDEX_NONE;
+	}
+
+	// 클래스 기본 객체의 컴포넌트는 등록되지 않으므로 상대 트랜스폼으로 계산
+	const USphereComponent* DefaultCollision = Info.DefaultItem->Collision;
+	Info.MeshOffset = Info.DefaultItem->StaticMesh->GetRelativeTransform() * DefaultCollision->GetRelativeTransform();
+	Info.PickupRadius = DefaultCollision->GetUnscaledSphereRadius() * DefaultCollision->GetRelativeScale3D().GetAbsMax();
+	Info.Archetype = EntityManager->CreateArchetype(Fragments);
+	Info.bCanSimulate = true;
+
+	ItemClasses.Add(ItemClass);
+	return ClassInfos.Add(Info);
+}
+
+FMassEntityManager* UItemMassSubsystem::GetEntityManager() const
+{
+	UMassEntitySubsystem* EntitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>();
+	return EntitySubsystem ? &EntitySubsystem->GetMutableEntityManager() : nullptr;
+}
+
+void UItemMassSubsystem::HandlePickups(const TArray<APawn*>& PlayerPawns)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	for (const TPair<FMassEntityHandle, int32>& Pickup : PickupProcessor->Pickups)
+	{
+		const FMassEntityHandle Entity = Pickup.Key;
+		APawn* Pawn = PlayerPawns.IsValidIndex(Pickup.Value) ? PlayerPawns[Pickup.Value] : nullptr;
+		// 앞선 픽업이 웨이브/레벨을 끝내 이미 정리되었을 수 있음
+		if (!IsValid(Pawn) || !LiveEntities.Contains(Entity))
+			continue;
+
+		SCOPE_CYCLE_COUNTER(STAT_Sparta_ActivateItem);
+		TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassSubsystem::ActivateItem);
+
+		const FItemMassTypeFragment Type = EntityManager->GetFragmentDataChecked<FItemMassTypeFragment>(Entity);
+		const FVector Location = EntityManager->GetFragmentDataChecked<FItemMassLocationFragment>(Entity).BaseLocation;
+		const FItemClassInfo& Info = ClassInfos[Type.ClassIndex];
+
+		ASpartaGameState* GameState = GetWorld()->GetGameState<ASpartaGameState>();
+		if (GameState)
+		{
+			GameState->RecordPickup();
+		}
+		Info.DefaultItem->PlayPickupFeedback(GetWorld(), Location, FRotator::ZeroRotator);
+
+		switch (Type.Kind)
+		{
+		case EItemMassKind::Coin:
+			// 점수 반영이 웨이브 완료로 이어질 수 있으므로 먼저 제거
+			DestroyItem(Entity);
+			if (GameState)
+			{
+				GameState->AddScore(Type.Value);
+				GameState->OnCoinCollected();
+			}
+			break;
+
+		case EItemMassKind::Healing:
+			DestroyItem(Entity);
+			if (ASpartaCharacter* PlayerCharacter = Cast<ASpartaCharacter>(Pawn))
+			{
+				PlayerCharacter->AddHealth(Type.Value);
+			}
+			break;
+
+		case EItemMassKind::Mine:
+			// 폭발 대기는 UItemMassFuseProcessor가 처리
+			EntityManager->AddTagToEntity(Entity, FItemMassArmedTag::StaticStruct());
+			break;
+		}
+	}
+	PickupProcessor->Pickups.Reset();
+}
+
+void UItemMassSubsystem::HandleDetonations(const TArray<APawn*>& PlayerPawns)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	for (const FMassEntityHandle Entity : FuseProcessor->Detonations)
+	{
+		if (!LiveEntities.Contains(Entity))
+			continue;
+
+		SCOPE_CYCLE_COUNTER(STAT_Sparta_Explode);
+		TRACE_CPUPROFILER_EVENT_SCOPE(UItemMassSubsystem::Explode);
+
+		const FItemMassTypeFragment Type = EntityManager->GetFragmentDataChecked<FItemMassTypeFragment>(Entity);
+		const FVector Location = EntityManager->GetFragmentDataChecked<FItemMassLocationFragment>(Entity).BaseLocation;
+		const float Radius = EntityManager->GetFragmentDataChecked<FItemMassFuseFragment>(Entity).Radius;
+		const AMineItem* DefaultMine = CastChecked<AMineItem>(ClassInfos[Type.ClassIndex].DefaultItem);
+
+		DestroyItem(Entity);
+		DefaultMine->PlayExplosionFeedback(GetWorld(), Location, FRotator::ZeroRotator);
+
+		// AMineItem::Explode와 같이 범위 안의 플레이어에게만 데미지
+		for (APawn* Pawn : PlayerPawns)
+		{
+			if (!IsValid(Pawn) || !ABaseItem::IsPlayerPawn(Pawn))
+				continue;
+
+			const float HitRadius = Radius + Pawn->GetSimpleCollisionRadius();
+			if (FVector::DistSquared(Pawn->GetActorLocation(), Location) <= FMath::Square(HitRadius))
+			{
+				UGameplayStatics::ApplyDamage(
+					Pawn,
+					Type.Value,
+					nullptr,
+					nullptr,
+					UDamageType::StaticClass());
+			}
+		}
+	}
+	FuseProcessor->Detonations.Reset();
+}
+
+void UItemMassSubsystem::DestroyItem(FMassEntityHandle Entity)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || LiveEntities.Remove(Entity) == 0)
+		return;
+
+	const FItemMassTypeFragment& Type = EntityManager->GetFragmentDataChecked<FItemMassTypeFragment>(Entity);
+	const FItemMassRenderFragment& Render = EntityManager->GetFragmentDataChecked<FItemMassRenderFragment>(Entity);
+	if (UItemInstancingSubsystem* InstancingSubsystem = GetWorld()->GetSubsystem<UItemInstancingSubsystem>())
+	{
+		InstancingSubsystem->ReleaseInstance(ItemClasses[Type.ClassIndex], Render.InstanceIndex);
+	}
+
+	EntityManager->DestroyEntity(Entity);
+}
@@ -0,0 +1,133 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemProximitySubsystem.h"
+#include "BaseItem.h"
+#include "SpartaStats.h"
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+void UItemProximitySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (NumItems == 0)
+		return;
+
+	UWorld* World = GetWorld();
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!Pawn || !Pawn->IsPlayerControlled())
+			continue;
+
+		float PawnRadius = 0.f;
+		float PawnHalfHeight = 0.f;
+		Pawn->GetSimpleCollisionCylinder(PawnRadius, PawnHalfHeight);
+
+		const FVector PawnLocation = Pawn->GetActorLocation();
+		const float SearchRadius = PawnRadius + MaxItemRadius;
+		const FIntVector MinCell = GetCell(PawnLocation - FVector(SearchRadius, SearchRadius, PawnHalfHeight + MaxItemRadius));
+		const FIntVector MaxCell = GetCell(PawnLocation + FVector(SearchRadius, SearchRadius, PawnHalfHeight + MaxItemRadius));
+
+		// 플레이어 캡슐과 아이템 구가 겹치는지 주변 칸만 검사
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				for (int32 Z = MinCell.Z; Z <= MaxCell.Z; Z++)
+				{
+					const TArray<ABaseItem*>* CellItems = Cells.Find(FIntVector(X, Y, Z));
+					if (!CellItems)
+						continue;
+
+					for (ABaseItem* Item : *CellItems)
+					{
+						const FVector Delta = Item->ProximityLocation - PawnLocation;
+						const float HorizontalRadius = PawnRadius + Item->ProximityRadius;
+
+						if (Delta.SizeSquared2D() <= FMath::Square(HorizontalRadius)
+							&& FMath::Abs(Delta.Z) <= PawnHalfHeight + Item->ProximityRadius)
+						{
+							PendingPickups.Emplace(Item, Pawn);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// 격자를 순회하는 동안에는 등록 해제가 일어나지 않도록 판정이 끝난 뒤 처리
+	for (const TPair<ABaseItem*, AActor*>& Pickup : PendingPickups)
+	{
+		ABaseItem* Item = Pickup.Key;
+		if (!IsValid(Item) || Item->ProximityIndex == INDEX_NONE)
+			continue;
+
+		// 한 번 획득 판정된 아이템은 다시 판정하지 않음 (BeginOverlap과 같은 동작)
+		UnregisterItem(Item);
+
+		SCOPE_CYCLE_COUNTER(STAT_Sparta_ActivateItem);
+		TRACE_CPUPROFILER_EVENT_SCOPE(ABaseItem::ActivateItem);
+		Item->ActivateItem(Pickup.Value);
+	}
+	PendingPickups.Reset();
+}
+
+TStatId UItemProximitySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UItemProximitySubsystem, STATGROUP_Tickables);
+}
+
+void UItemProximitySubsystem::RegisterItem(ABaseItem* Item)
+{
+	if (!Item || Item->ProximityIndex != INDEX_NONE)
+		return;
+
+	Item->ProximityLocation = Item->GetActorLocation();
+	Item->ProximityRadius = Item->Collision->GetScaledSphereRadius();
+	Item->ProximityCell = GetCell(Item->ProximityLocation);
+
+	TArray<ABaseItem*>& CellItems = Cells.FindOrAdd(Item->ProximityCell);
+	Item->ProximityIndex = CellItems.Add(Item);
+
+	MaxItemRadius = FMath::Max(MaxItemRadius, Item->ProximityRadius);
+	NumItems++;
+}
+
+void UItemProximitySubsystem::UnregisterItem(ABaseItem* Item)
+{
+	if (!Item || Item->ProximityIndex == INDEX_NONE)
+		return;
+
+	TArray<ABaseItem*>* CellItems = Cells.Find(Item->ProximityCell);
+	const int32 Index = Item->ProximityIndex;
+	Item->ProximityIndex = INDEX_NONE;
+
+	if (!CellItems || !CellItems->IsValidIndex(Index) || (*CellItems)[Index] != Item)
+		return;
+
+	// 마지막 아이템을 빈 자리로 옮기고 인덱스 갱신
+	CellItems->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (CellItems->IsValidIndex(Index))
+	{
+		(*CellItems)[Index]->ProximityIndex = Index;
+	}
+	NumItems--;
+}
+
+bool UItemProximitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FIntVector UItemProximitySubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize),
+		FMath::FloorToInt32(Location.Z / CellSize));
+}
@@ -0,0 +1,118 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "ItemSpawnSampler.h"
+#include "Engine/DataTable.h"
+
+void FItemSpawnSampler::Build(UDataTable* DataTable)
+{
+	Reset();
+
+	if (!DataTable)
+		return;
+
+	SourceTable = DataTable;
+
+	// 확률이 0 이하인 Row는 뽑힐 일이 없으므로 제외
+	TArray<FItemSpawnRow*> AllRows;
+	static const FString ContextString(TEXT("ItemSpawnSampler"));
+	DataTable->GetAllRows(ContextString, AllRows);
+
+	float TotalChance = 0.f;
+	for (FItemSpawnRow* Row : AllRows)
+	{
+		if (Row && Row->SpawnChance > 0.f)
+		{
+			Rows.Add(Row);
+			TotalChance += Row->SpawnChance;
+		}
+	}
+
+	const int32 Count = Rows.Num();
+	if (Count == 0)
+		return;
+
+	Probabilities.SetNumUninitialized(Count);
+	Aliases.SetNumUninitialized(Count);
+
+	// 평균이 1이 되도록 스케일한 확률
+	TArray<float> Scaled;
+	Scaled.SetNumUninitialized(Count);
+
+	TArray<int32> Small;
+	TArray<int32> Large;
+	Small.Reserve(Count);
+	Large.Reserve(Count);
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		Scaled[i] = Rows[i]->SpawnChance * Count / TotalChance;
+		Aliases[i] = i;
+
+		if (Scaled[i] < 1.f)
+		{
+			Small.Add(i);
+		}
+		else
+		{
+			Large.Add(i);
+		}
+	}
+
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 Less = Small.Pop(EAllowShrinking::No);
+		const int32 More = Large.Pop(EAllowShrinking::No);
+
+		Probabilities[Less] = Scaled[Less];
+		Aliases[Less] = More;
+
+		// 부족한 칸을 채워준 만큼 큰 칸에서 차감
+		Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.f;
+
+		if (Scaled[More] < 1.f)
+		{
+			Small.Add(More);
+		}
+		else
+		{
+			Large.Add(More);
+		}
+	}
+
+	// 부동소수점 오차로 남은 칸은 항상 자기 자신이 선택되도록 처리
+	for (int32 Index : Large)
+	{
+		Probabilities[Index] = 1.f;
+	}
+	for (int32 Index : Small)
+	{
+		Probabilities[Index] = 1.f;
+	}
+}
+
+void FItemSpawnSampler::Reset()
+{
+	Rows.Reset();
+	Probabilities.Reset();
+	Aliases.Reset();
+	SourceTable = nullptr;
+}
+
+FItemSpawnRow* FItemSpawnSampler::Sample(float RandValue) const
+{
+	return GetRow(SampleIndex(RandValue));
+}
+
+int32 FItemSpawnSampler::SampleIndex(float RandValue) const
+{
+	const int32 Count = Rows.Num();
+	if (Count == 0)
+		return INDEX_NONE;
+
+	// 난수 하나를 칸 인덱스와 칸 내부 확률로 나누어 사용
+	const float Scaled = FMath::Clamp(RandValue, 0.f, 1.f) * Count;
+	const int32 Index = FMath::Min(FMath::FloorToInt32(Scaled), Count - 1);
+	const float Fraction = Scaled - Index;
+
+	return Fraction < Probabilities[Index] ? Index : Aliases[Index];
+}
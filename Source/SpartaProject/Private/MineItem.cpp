@@ -1,96 +1,104 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "MineItem.h"
-#include "Components/SphereComponent.h"
-#include "Kismet/GameplayStatics.h"
-#include "Particles/ParticleSystemComponent.h"
-
-AMineItem::AMineItem()
-{
-	ExplosionDelay = 2.f;
-	ExplosionRadius = 300.f;
-	ExplosionDamage = 30;
-	ItemType = "Mine";
-	bHasExploded = false;
-
-	ExplosionCollision = CreateDefaultSubobject<USphereComponent>(TEXT("ExplosionCollision"));
-	ExplosionCollision->InitSphereRadius(ExplosionRadius);
-	ExplosionCollision->SetCollisionProfileName(TEXT("OverlapAllDynamic"));
-	ExplosionCollision->SetupAttachment(Scene);
-}
-
-void AMineItem::ActivateItem(AActor* Activator)
-{
-	if (bHasExploded)
-		return;
-
-	Super::ActivateItem(Activator);
-
-	GetWorld()->GetTimerManager().SetTimer(
-		ExplosionTimerHandle,
-		this,
-		&AMineItem::Explode,
-		ExplosionDelay,
-		false);
-
-	bHasExploded = true;
-}
-
-void AMineItem::Explode()
-{
-	UParticleSystemComponent* Particle = nullptr;
-
-	if (ExplosionParticle)
-	{
-		Particle = UGameplayStatics::SpawnEmitterAtLocation(
-			GetWorld(),
-			ExplosionParticle,
-			GetActorLocation(),
-			GetActorRotation(),
-			false);
-	}
-
-  if (ExplosionSound)
-	{
-		UGameplayStatics::PlaySoundAtLocation(
-			GetWorld(),
-			ExplosionSound,
-			GetActorLocation());
-	}
-
-	TArray<AActor*> OverlappingActors;
-	ExplosionCollision->GetOverlappingActors(OverlappingActors);
-
-	for (AActor* Actor : OverlappingActors)
-	{
-		if (Actor && Actor->ActorHasTag("Player"))
-		{
-			// 데미지를 발생시켜 Actor->TakeDamage()가 실행되도록 함
-			UGameplayStatics::ApplyDamage(
-				Actor,
-				ExplosionDamage,
-				nullptr,					 // 데미지를 유발한 주체 (지뢰를 설치한 캐릭터가 없으므로 nullptr)
-				this,						 // 데미지를 준 액터 (지뢰 자신)
-				UDamageType::StaticClass()); // 기본 데미지 타입
-		}
-	}
-	DestroyItem();
-
-	if (Particle)
-	{
-		FTimerHandle DestroyParticleTimerHandle;
-		TWeakObjectPtr<UParticleSystemComponent> WeakParticle = Particle;
-
-		GetWorld()->GetTimerManager().SetTimer(
-			DestroyParticleTimerHandle,
-			[WeakParticle]()
-			{
-				if (WeakParticle.IsValid())
-				{
-					WeakParticle->DestroyComponent();
-				}
-			},
-			2.0f,
-			false);
-	}
-}
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MineItem.h"
+#include "Kismet/GameplayStatics.h"
+#include "ItemEffectSubsystem.h"
+#include "SpartaStats.h"
+#include "NiagaraSystem.h"
+#include "Particles/ParticleSystem.h"
+#include "Engine/OverlapResult.h"
+
+AMineItem::AMineItem()
+{
+	ExplosionDelay = 2.f;
+	ExplosionRadius = 300.f;
+	ExplosionDamage = 30;
+	ItemType = "Mine";
+	bHasExploded = false;
+}
+
+void AMineItem::OnAcquiredFromPool()
+{
+	Super::OnAcquiredFromPool();
+
+	// 재사용 시 다시 발동 가능하도록 초기화
+	bHasExploded = false;
+}
+
+void AMineItem::ActivateItem(AActor* Activator)
+{
+	if (bHasExploded)
+		return;
+
+	Super::ActivateItem(Activator);
+
+	GetWorld()->GetTimerManager().SetTimer(
+		ExplosionTimerHandle,
+		this,
+		&AMineItem::Explode,
+		ExplosionDelay,
+		false);
+
+	bHasExploded = true;
+}
+
+void AMineItem::Explode()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_Explode);
+	TRACE_CPUPROFILER_EVENT_SCOPE(AMineItem::Explode);
+
+	PlayExplosionFeedback(GetWorld(), GetActorLocation(), GetActorRotation());
+
+	// 폭발 순간에만 Pawn 채널을 대상으로 한 번 구 범위 검사
+	TArray<FOverlapResult> OverlapResults;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MineExplosion), false, this);
+	GetWorld()->OverlapMultiByObjectType(
+		OverlapResults,
+		GetActorLocation(),
+		FQuat::Identity,
+		FCollisionObjectQueryParams(ECC_Pawn),
+		FCollisionShape::MakeSphere(ExplosionRadius),
+		QueryParams);
+
+	// 한 액터의 여러 컴포넌트가 걸려도 데미지는 한 번만
+	TArray<AActor*, TInlineAllocator<4>> DamagedActors;
+	for (const FOverlapResult& OverlapResult : OverlapResults)
+	{
+		AActor* Actor = OverlapResult.GetActor();
+		if (IsPlayerPawn(Actor) && !DamagedActors.Contains(Actor))
+		{
+			DamagedActors.Add(Actor);
+
+			// 데미지를 발생시켜 Actor->TakeDamage()가 실행되도록 함
+			UGameplayStatics::ApplyDamage(
+				Actor,
+				ExplosionDamage,
+				nullptr,					 // 데미지를 유발한 주체 (지뢰를 설치한 캐릭터가 없으므로 nullptr)
+				this,						 // 데미지를 준 액터 (지뢰 자신)
+				UDamageType::StaticClass()); // 기본 데미지 타입
+		}
+	}
+	DestroyItem();
+}
+
+void AMineItem::PlayExplosionFeedback(UWorld* World, const FVector& Location, const FRotator& Rotation) const
+{
+	if (UItemEffectSubsystem* EffectSubsystem = World->GetSubsystem<UItemEffectSubsystem>())
+	{
+		// Niagara 이펙트가 있으면 우선 사용하고, 없으면 기존 Cascade 파티클 사용
+		UFXSystemAsset* Effect = ExplosionParticle.Get();
+		if (ExplosionEffect)
+		{
+			Effect = ExplosionEffect.Get();
+		}
+		EffectSubsystem->SpawnEffect(Effect, Location, Rotation);
+	}
+
+	if (ExplosionSound)
+	{
+		UGameplayStatics::PlaySoundAtLocation(
+			World,
+			ExplosionSound,
+			Location);
+	}
+}
@@ -0,0 +1,107 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PickupAudioSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+#include "Sound/SoundConcurrency.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarPickupMaxVoicesPerType(
+		TEXT("Sparta.PickupAudio.MaxVoicesPerType"),
+		4,
+		TEXT("동시 재생 설정이 없는 아이템의 종류별 최대 픽업 사운드 수 (넘으면 가장 오래된 소리를 끔)"));
+}
+
+void UPickupAudioSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (TPair<FName, FPickupSoundState>& Pair : SoundStates)
+	{
+		FPickupSoundState& State = Pair.Value;
+		if (Now - State.WindowStartTime < CoalesceWindow)
+			continue;
+
+		if (State.NumPending > 0)
+		{
+			// 구간 동안 모인 픽업을 한 번에 재생하고 다음 구간 시작
+			State.EscalationStep = FMath::Min(State.EscalationStep + 1, MaxEscalationSteps);
+			PlayCue(State, Now);
+		}
+		else
+		{
+			// 픽업이 끊겼으면 피치/볼륨을 원래대로
+			State.EscalationStep = 0;
+		}
+	}
+}
+
+TStatId UPickupAudioSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPickupAudioSubsystem, STATGROUP_Tickables);
+}
+
+void UPickupAudioSubsystem::PlayPickupSound(USoundBase* Sound, FName ItemType, const FVector& Location, USoundConcurrency* Concurrency)
+{
+	if (!Sound)
+		return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	FPickupSoundState& State = SoundStates.FindOrAdd(ItemType);
+	State.Sound = Sound;
+	State.Concurrency = Concurrency ? Concurrency : GetDefaultConcurrency(ItemType);
+	State.LastLocation = Location;
+	State.NumPending++;
+
+	// 합치기 구간 밖이면 바로 재생 (첫 픽업은 지연 없이 들려야 함)
+	if (Now - State.WindowStartTime >= CoalesceWindow)
+	{
+		PlayCue(State, Now);
+	}
+}
+
+bool UPickupAudioSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPickupAudioSubsystem::PlayCue(FPickupSoundState& State, double Now)
+{
+	State.NumPending = 0;
+	State.WindowStartTime = Now;
+
+	USoundBase* Sound = State.Sound.Get();
+	if (!Sound)
+		return;
+
+	UGameplayStatics::PlaySoundAtLocation(
+		GetWorld(),
+		Sound,
+		State.LastLocation,
+		FRotator::ZeroRotator,
+		1.f + VolumeStep * State.EscalationStep,
+		1.f + PitchStep * State.EscalationStep,
+		0.f,
+		nullptr,
+		State.Concurrency.Get());
+}
+
+USoundConcurrency* UPickupAudioSubsystem::GetDefaultConcurrency(FName ItemType)
+{
+	TObjectPtr<USoundConcurrency>& Concurrency = DefaultConcurrencies.FindOrAdd(ItemType);
+	if (!Concurrency)
+	{
+		// 설정 객체 하나가 하나의 동시 재생 그룹이므로 종류별로 따로 만듦
+		Concurrency = NewObject<USoundConcurrency>(this);
+		Concurrency->Concurrency.bLimitToOwner = false;
+		Concurrency->Concurrency.ResolutionRule = EMaxConcurrentResolutionRule::StopOldest;
+	}
+
+	// 콘솔 변수를 바꾸면 다음 재생부터 반영
+	Concurrency->Concurrency.MaxCount = FMath::Max(CVarPickupMaxVoicesPerType.GetValueOnGameThread(), 1);
+	return Concurrency;
+}
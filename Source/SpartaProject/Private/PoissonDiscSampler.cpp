@@ -0,0 +1,148 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "PoissonDiscSampler.h"
+
+namespace
+{
+	// 활성 점 하나 주변에서 새 점을 찾는 시도 횟수
+	constexpr int32 MaxCandidateAttempts = 30;
+	// 격자 칸 수 상한 (반경이 영역에 비해 너무 작을 때 메모리 폭주 방지)
+	constexpr int64 MaxGridCells = 4 * 1024 * 1024;
+	// GenerateCount에서 점 하나당 허용하는 무작위 시도 횟수
+	constexpr int32 MaxDartAttemptsPerPoint = 30;
+	// Bridson 샘플링이 가득 채웠을 때의 밀도 (Radius^2 면적당 점 개수, 실측 약 0.7)
+	constexpr float FilledPointsPerRadiusSquared = 0.7f;
+}
+
+bool FPoissonDiscGrid::Init(const FBox2D& InBounds, float InRadius)
+{
+	Bounds = InBounds;
+	Radius = FMath::Max(InRadius, 1.f);
+	CellSize = Radius / UE_SQRT_2;
+
+	const FVector2D Size = Bounds.GetSize();
+	GridWidth = FMath::Max(FMath::CeilToInt32(Size.X / CellSize), 1);
+	GridHeight = FMath::Max(FMath::CeilToInt32(Size.Y / CellSize), 1);
+
+	if (static_cast<int64>(GridWidth) * GridHeight > MaxGridCells)
+		return false;
+
+	Cells.Init(INDEX_NONE, GridWidth * GridHeight);
+	Points.Reset();
+	return true;
+}
+
+FIntPoint FPoissonDiscGrid::GetCell(const FVector2D& Point) const
+{
+	const FVector2D Local = (Point - Bounds.Min) / CellSize;
+	return FIntPoint(
+		FMath::Clamp(FMath::FloorToInt32(Local.X), 0, GridWidth - 1),
+		FMath::Clamp(FMath::FloorToInt32(Local.Y), 0, GridHeight - 1));
+}
+
+bool FPoissonDiscGrid::IsFarEnough(const FVector2D& Point) const
+{
+	const FIntPoint Cell = GetCell(Point);
+	const float RadiusSquared = Radius * Radius;
+
+	for (int32 Y = FMath::Max(Cell.Y - 2, 0); Y <= FMath::Min(Cell.Y + 2, GridHeight - 1); Y++)
+	{
+		for (int32 X = FMath::Max(Cell.X - 2, 0); X <= FMath::Min(Cell.X + 2, GridWidth - 1); X++)
+		{
+			const int32 PointIndex = Cells[Y * GridWidth + X];
+			if (PointIndex != INDEX_NONE && FVector2D::DistSquared(Points[PointIndex], Point) < RadiusSquared)
+				return false;
+		}
+	}
+	return true;
+}
+
+void FPoissonDiscGrid::Add(const FVector2D& Point)
+{
+	const FIntPoint Cell = GetCell(Point);
+	Cells[Cell.Y * GridWidth + Cell.X] = Points.Add(Point);
+}
+
+bool FPoissonDiscSampler::Generate(const FBox2D& Bounds, float Radius, const FRandomStream& Stream, TArray<FVector2D>& OutPoints)
+{
+	OutPoints.Reset();
+	Radius = FMath::Max(Radius, 1.f);
+
+	FPoissonDiscGrid Grid;
+	if (!Grid.Init(Bounds, Radius))
+		return false;
+
+	// 첫 점은 영역 안 아무 곳에
+	Grid.Add(FVector2D(
+		Stream.FRandRange(Bounds.Min.X, Bounds.Max.X),
+		Stream.FRandRange(Bounds.Min.Y, Bounds.Max.Y)));
+
+	TArray<int32> ActiveList;
+	ActiveList.Add(0);
+
+	while (ActiveList.Num() > 0)
+	{
+		const int32 ActiveSlot = Stream.RandRange(0, ActiveList.Num() - 1);
+		const FVector2D Origin = Grid.GetPoints()[ActiveList[ActiveSlot]];
+
+		bool bFoundCandidate = false;
+		for (int32 Attempt = 0; Attempt < MaxCandidateAttempts; Attempt++)
+		{
+			// 반경 r ~ 2r 고리 안에서 후보 선택
+			const float Angle = Stream.FRandRange(0.f, UE_TWO_PI);
+			const float Distance = Stream.FRandRange(Radius, 2.f * Radius);
+			const FVector2D Candidate = Origin + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Distance;
+
+			if (Bounds.IsInside(Candidate) && Grid.IsFarEnough(Candidate))
+			{
+				ActiveList.Add(Grid.GetPoints().Num());
+				Grid.Add(Candidate);
+				bFoundCandidate = true;
+				break;
+			}
+		}
+
+		// 주변에 더 넣을 자리가 없는 점은 활성 목록에서 제거
+		if (!bFoundCandidate)
+		{
+			ActiveList.RemoveAtSwap(ActiveSlot, 1, EAllowShrinking::No);
+		}
+	}
+
+	OutPoints = Grid.GetPoints();
+	return true;
+}
+
+bool FPoissonDiscSampler::GenerateCount(const FBox2D& Bounds, float Radius, int32 MaxPoints, const FRandomStream& Stream, TArray<FVector2D>& OutPoints)
+{
+	OutPoints.Reset();
+	Radius = FMath::Max(Radius, 1.f);
+
+	FPoissonDiscGrid Grid;
+	if (!Grid.Init(Bounds, Radius))
+		return false;
+
+	const int32 MaxAttempts = MaxPoints * MaxDartAttemptsPerPoint;
+	for (int32 Attempt = 0; Attempt < MaxAttempts && Grid.GetPoints().Num() < MaxPoints; Attempt++)
+	{
+		const FVector2D Candidate(
+			Stream.FRandRange(Bounds.Min.X, Bounds.Max.X),
+			Stream.FRandRange(Bounds.Min.Y, Bounds.Max.Y));
+
+		if (Grid.IsFarEnough(Candidate))
+		{
+			Grid.Add(Candidate);
+		}
+	}
+
+	OutPoints = Grid.GetPoints();
+	return true;
+}
+
+int32 FPoissonDiscSampler::EstimateCapacity(const FBox2D& Bounds, float Radius)
+{
+	Radius = FMath::Max(Radius, 1.f);
+	const FVector2D Size = Bounds.GetSize();
+	const double Capacity = Size.X * Size.Y / (Radius * Radius) * FilledPointsPerRadiusSquared;
+	return static_cast<int32>(FMath::Min(Capacity, static_cast<double>(MAX_int32)));
+}
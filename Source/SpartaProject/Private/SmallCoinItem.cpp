@@ -1,14 +1,14 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SmallCoinItem.h"
-
-ASmallCoinItem::ASmallCoinItem()
-{
-	PointValue = 10;
-	ItemType = "SmallCoin";
-}
-
-void ASmallCoinItem::ActivateItem(AActor* Activator)
-{
-	Super::ActivateItem(Activator);
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SmallCoinItem.h"
+
+ASmallCoinItem::ASmallCoinItem()
+{
+	PointValue = 10;
+	ItemType = "SmallCoin";
+}
+
+void ASmallCoinItem::ActivateItem(AActor* Activator)
+{
+	Super::ActivateItem(Activator);
+}
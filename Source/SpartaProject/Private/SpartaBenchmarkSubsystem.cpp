@@ -0,0 +1,379 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaBenchmarkSubsystem.h"
+#include "SpawnVolume.h"
+#include "SpawnVolumeSubsystem.h"
+#include "BaseItem.h"
+#include "CoinItem.h"
+#include "SpartaGameState.h"
+#include "ItemAnimationSubsystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/Engine.h"
+#include "UObject/UObjectGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// 측정할 아이템 수
+	constexpr int32 BenchmarkItemCounts[] = { 100, 1000, 10000 };
+	// GetRandomItem 측정 횟수
+	constexpr int32 NumRandomItemSamples = 100000;
+	// 애니메이션 Tick 평균을 낼 프레임 수
+	constexpr int32 NumTickFrames = 60;
+	// 항상 같은 아이템 구성으로 측정하기 위한 고정 시드
+	constexpr int32 BenchmarkSeed = 12345;
+	// 중앙값을 낼 기본 측정 횟수
+	constexpr int32 DefaultNumRuns = 5;
+
+	void RunBenchmarkCommand(const TArray<FString>& Args, UWorld* World, bool bAllowMapTravel)
+	{
+		USpartaBenchmarkSubsystem* BenchmarkSubsystem = World ? World->GetSubsystem<USpartaBenchmarkSubsystem>() : nullptr;
+		if (!BenchmarkSubsystem)
+			return;
+
+		// SpawnVolume이 없는 맵이면 벤치마크 맵을 열고, 로드가 끝나면 그 월드에서 다시 실행
+		if (bAllowMapTravel && !BenchmarkSubsystem->HasSpawnVolume())
+		{
+			FString MapName = USpartaBenchmarkSubsystem::DefaultMapName;
+			for (const FString& Arg : Args)
+			{
+				FParse::Value(*Arg, TEXT("Map="), MapName);
+			}
+
+			UE_LOG(LogTemp, Warning, TEXT("[Benchmark] No SpawnVolume in %s, opening %s"), *World->GetMapName(), *MapName);
+
+			static FDelegateHandle PostLoadMapHandle;
+			FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+			PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddLambda([Args](UWorld* LoadedWorld)
+			{
+				FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+				RunBenchmarkCommand(Args, LoadedWorld, false);
+			});
+
+			GEngine->Exec(World, *FString::Printf(TEXT("open %s"), *MapName));
+			return;
+		}
+
+		const bool bPassed = BenchmarkSubsystem->RunBenchmark(Args);
+
+		// 무인 실행이면 결과를 종료 코드로 전달
+		if (FApp::IsUnattended())
+		{
+			FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs BenchmarkCommand(
+		TEXT("Sparta.Benchmark"),
+		TEXT("스폰/픽업 성능 측정. 인자: Tolerance=0.15 Runs=5 Baseline=<경로> Map=<맵> UpdateBaseline"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			RunBenchmarkCommand(Args, World, true);
+		}));
+}
+
+const TCHAR* const USpartaBenchmarkSubsystem::DefaultMapName = TEXT("/Game/Maps/BasicLevel");
+
+FString USpartaBenchmarkSubsystem::GetDefaultBaselinePath()
+{
+	return FPaths::ProjectDir() / TEXT("Benchmarks/SpartaBenchmarkBaseline.json");
+}
+
+bool USpartaBenchmarkSubsystem::RunBenchmark(const TArray<FString>& Args)
+{
+	double Tolerance = 0.15;
+	int32 NumRuns = DefaultNumRuns;
+	FString BaselinePath = GetDefaultBaselinePath();
+	bool bUpdateBaseline = false;
+
+	for (const FString& Arg : Args)
+	{
+		FParse::Value(*Arg, TEXT("Tolerance="), Tolerance);
+		FParse::Value(*Arg, TEXT("Runs="), NumRuns);
+		FParse::Value(*Arg, TEXT("Baseline="), BaselinePath);
+		bUpdateBaseline |= Arg.Equals(TEXT("UpdateBaseline"), ESearchCase::IgnoreCase);
+	}
+	NumRuns = FMath::Max(NumRuns, 1);
+
+	ASpawnVolume* Volume = FindSpawnVolume();
+	if (!Volume)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[Benchmark] No SpawnVolume in %s (run on a level map such as %s)"), *GetWorld()->GetMapName(), DefaultMapName);
+		return false;
+	}
+
+	// 측정 중에 웨이브 스폰/코인 수집으로 레벨이 끝나거나 맵이 바뀌지 않도록 웨이브 진행을 멈춤
+	ASpartaGameState* GameState = GetWorld()->GetGameState<ASpartaGameState>();
+	const bool bWasWaveLoopSuspended = GameState && GameState->IsWaveLoopSuspended();
+	if (GameState)
+	{
+		GameState->SetWaveLoopSuspended(true);
+	}
+
+	Volume->SetCurrentDataTableIndex(0, 0);
+
+	// 첫 실행에는 풀 생성/캐시 워밍업 비용이 섞이고 실행마다 스케줄링 잡음이 있으므로 여러 번 측정해 중앙값 사용
+	TArray<FBenchmarkResults> Runs;
+	for (int32 Run = 0; Run < NumRuns; Run++)
+	{
+		FBenchmarkResults& RunResults = Runs.AddDefaulted_GetRef();
+		MeasureGetRandomItem(Volume, RunResults);
+		for (int32 Count : BenchmarkItemCounts)
+		{
+			MeasureSpawnTickAndPickup(Volume, Count, RunResults);
+		}
+	}
+
+	if (GameState)
+	{
+		GameState->SetWaveLoopSuspended(bWasWaveLoopSuspended);
+	}
+
+	const FBenchmarkResults Results = GetMedianResults(Runs);
+	for (const TPair<FString, double>& Result : Results)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Benchmark] %s: %.3f ms (median of %d runs)"), *Result.Key, Result.Value, NumRuns);
+	}
+
+	WriteResults(FPaths::ProjectSavedDir() / TEXT("Benchmarks/SpartaBenchmark.json"), Results, NumRuns);
+
+	if (bUpdateBaseline)
+	{
+		WriteResults(BaselinePath, Results, NumRuns);
+		return true;
+	}
+
+	return CompareWithBaseline(BaselinePath, Results, Tolerance);
+}
+
+bool USpartaBenchmarkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+ASpawnVolume* USpartaBenchmarkSubsystem::FindSpawnVolume() const
+{
+	const USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>();
+	if (VolumeSubsystem && VolumeSubsystem->GetVolumes().Num() > 0)
+	{
+		return VolumeSubsystem->GetVolumes()[0];
+	}
+	return nullptr;
+}
+
+void USpartaBenchmarkSubsystem::MeasureGetRandomItem(ASpawnVolume* Volume, FBenchmarkResults& OutResults) const
+{
+	Volume->SetSpawnSeed(BenchmarkSeed);
+
+	int32 NumValidRows = 0;
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumRandomItemSamples; i++)
+	{
+		// 결과를 사용해야 최적화로 반복문이 사라지지 않음
+		NumValidRows += Volume->GetRandomItem() ? 1 : 0;
+	}
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	OutResults.Emplace(FString::Printf(TEXT("GetRandomItem_%d"), NumRandomItemSamples), ElapsedMs);
+	UE_LOG(LogTemp, Verbose, TEXT("[Benchmark] GetRandomItem valid rows: %d"), NumValidRows);
+}
+
+void USpartaBenchmarkSubsystem::MeasureSpawnTickAndPickup(ASpawnVolume* Volume, int32 Count, FBenchmarkResults& OutResults) const
+{
+	// 웨이브와 같은 경로로 아이템 선택/위치 배치 (게임 스레드 준비 + 워커 계산이 끝날 때까지)
+	double StartTime = FPlatformTime::Seconds();
+	const FWaveManifest Manifest = Volume->BuildWaveManifestAsync(0, 0, Count, BenchmarkSeed).Consume();
+	OutResults.Emplace(FString::Printf(TEXT("BuildWaveManifest_%d"), Count), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	TArray<AActor*> SpawnedActors;
+	SpawnedActors.Reserve(Manifest.Entries.Num());
+
+	// 매니페스트대로 스폰 (바닥 보정은 다음 프레임에 끝나는 비동기 트레이스라 제외하고 계산된 위치를 그대로 사용)
+	StartTime = FPlatformTime::Seconds();
+	for (const FWaveManifestEntry& Entry : Manifest.Entries)
+	{
+		if (AActor* SpawnedActor = Volume->SpawnItemAt(Entry.ItemClass, Entry.Location, Entry.Rotation))
+		{
+			SpawnedActors.Add(SpawnedActor);
+		}
+	}
+	OutResults.Emplace(FString::Printf(TEXT("SpawnManifest_%d"), Count), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	// 살아있는 아이템 Count개의 프레임당 애니메이션 비용
+	if (UItemAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UItemAnimationSubsystem>())
+	{
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < NumTickFrames; Frame++)
+		{
+			AnimationSubsystem->Tick(1.f / 60.f);
+		}
+		OutResults.Emplace(FString::Printf(TEXT("ItemTickPerFrame_%d"), Count), (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumTickFrames);
+	}
+
+	// 코인 픽업 경로 (ActivateItem -> AddScore -> OnCoinCollected, 웨이브 진행이 멈춰 있어 게임 상태는 바뀌지 않음)
+	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+	int32 NumPickups = 0;
+	double PickupSeconds = 0.0;
+	for (AActor*& SpawnedActor : SpawnedActors)
+	{
+		if (!PlayerPawn || !SpawnedActor->IsA<ACoinItem>())
+			continue;
+
+		IItemInterface* Item = CastChecked<ACoinItem>(SpawnedActor);
+		StartTime = FPlatformTime::Seconds();
+		Item->ActivateItem(PlayerPawn);
+		PickupSeconds += FPlatformTime::Seconds() - StartTime;
+		NumPickups++;
+
+		// 코인은 픽업 시 스스로 풀로 돌아감
+		SpawnedActor = nullptr;
+	}
+	// 시드가 고정이라 코인 수도 매번 같으므로 항목 이름은 스폰 수 기준으로 (실행 간/기준값과 같은 이름)
+	if (NumPickups > 0)
+	{
+		OutResults.Emplace(FString::Printf(TEXT("CoinPickup_%d"), Count), PickupSeconds * 1000.0);
+		UE_LOG(LogTemp, Verbose, TEXT("[Benchmark] Coin pickups out of %d items: %d"), Count, NumPickups);
+	}
+
+	// 남은 아이템 정리
+	for (AActor* SpawnedActor : SpawnedActors)
+	{
+		if (ABaseItem* Item = Cast<ABaseItem>(SpawnedActor))
+		{
+			Volume->ReleaseItem(Item);
+		}
+		else if (SpawnedActor)
+		{
+			SpawnedActor->Destroy();
+		}
+	}
+}
+
+USpartaBenchmarkSubsystem::FBenchmarkResults USpartaBenchmarkSubsystem::GetMedianResults(const TArray<FBenchmarkResults>& Runs)
+{
+	FBenchmarkResults MedianResults;
+	if (Runs.IsEmpty())
+		return MedianResults;
+
+	TArray<double> Samples;
+	for (const TPair<FString, double>& Result : Runs[0])
+	{
+		Samples.Reset();
+		for (const FBenchmarkResults& Run : Runs)
+		{
+			const TPair<FString, double>* RunResult = Run.FindByPredicate([&Result](const TPair<FString, double>& Other)
+			{
+				return Other.Key == Result.Key;
+			});
+			if (RunResult)
+			{
+				Samples.Add(RunResult->Value);
+			}
+		}
+
+		Samples.Sort();
+		const int32 Middle = Samples.Num() / 2;
+		const double Median = Samples.Num() % 2 == 1 ? Samples[Middle] : (Samples[Middle - 1] + Samples[Middle]) * 0.5;
+		MedianResults.Emplace(Result.Key, Median);
+	}
+
+	return MedianResults;
+}
+
+void USpartaBenchmarkSubsystem::WriteResults(const FString& FilePath, const FBenchmarkResults& Results, int32 NumRuns) const
+{
+	TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+	for (const TPair<FString, double>& Result : Results)
+	{
+		Metrics->SetNumberField(Result.Key, Result.Value);
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("Map"), GetWorld()->GetMapName());
+	Root->SetNumberField(TEXT("Seed"), BenchmarkSeed);
+	Root->SetNumberField(TEXT("Runs"), NumRuns);
+	// 측정 환경 (같은 환경에서 기록한 기준값끼리만 비교할 수 있음)
+	Root->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+	Root->SetStringField(TEXT("BuildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+	Root->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Root->SetObjectField(TEXT("Metrics"), Metrics);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	if (FFileHelper::SaveStringToFile(Output, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Benchmark] Results written to %s"), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("[Benchmark] Failed to write %s"), *FilePath);
+	}
+}
+
+bool USpartaBenchmarkSubsystem::CompareWithBaseline(const FString& BaselinePath, const FBenchmarkResults& Results, double Tolerance) const
+{
+	FString BaselineText;
+	if (!FFileHelper::LoadFileToString(BaselineText, *BaselinePath))
+	{
+		// 무인 실행(CI)에서 기준값이 없으면 회귀를 잡을 수 없으므로 실패 처리 (UpdateBaseline으로 생성)
+		if (FApp::IsUnattended())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[Benchmark] No baseline at %s (record one with UpdateBaseline)"), *BaselinePath);
+			return false;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("[Benchmark] No baseline at %s, skipping comparison"), *BaselinePath);
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineText);
+	const TSharedPtr<FJsonObject>* Metrics = nullptr;
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetObjectField(TEXT("Metrics"), Metrics))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[Benchmark] Invalid baseline file %s"), *BaselinePath);
+		return false;
+	}
+
+	// 다른 엔진/빌드 구성/CPU에서 기록한 기준값은 비교 결과를 믿기 어려우므로 경고
+	const FString CurrentEnvironment = FString::Printf(TEXT("%s %s %s"),
+		*FEngineVersion::Current().ToString(), LexToString(FApp::GetBuildConfiguration()), *FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	FString BaselineEngine, BaselineConfiguration, BaselineCPU;
+	Root->TryGetStringField(TEXT("EngineVersion"), BaselineEngine);
+	Root->TryGetStringField(TEXT("BuildConfiguration"), BaselineConfiguration);
+	Root->TryGetStringField(TEXT("CPU"), BaselineCPU);
+	const FString BaselineEnvironment = FString::Printf(TEXT("%s %s %s"), *BaselineEngine, *BaselineConfiguration, *BaselineCPU);
+	if (CurrentEnvironment != BaselineEnvironment)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[Benchmark] Baseline was recorded on [%s], running on [%s]"), *BaselineEnvironment, *CurrentEnvironment);
+	}
+
+	bool bPassed = true;
+	for (const TPair<FString, double>& Result : Results)
+	{
+		double BaselineMs = 0.0;
+		if (!(*Metrics)->TryGetNumberField(Result.Key, BaselineMs) || BaselineMs <= 0.0)
+			continue;
+
+		// 기준값보다 Tolerance 비율 이상 느려지면 실패
+		if (Result.Value > BaselineMs * (1.0 + Tolerance))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[Benchmark] Regression in %s: %.3f ms (baseline %.3f ms, tolerance %.0f%%)"),
+				*Result.Key, Result.Value, BaselineMs, Tolerance * 100.0);
+			bPassed = false;
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[Benchmark] %s"), bPassed ? TEXT("PASSED") : TEXT("FAILED"));
+	return bPassed;
+}
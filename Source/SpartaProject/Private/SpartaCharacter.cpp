@@ -1,256 +1,267 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SpartaCharacter.h"
-#include "Camera/CameraComponent.h"
-#include "EnhancedInputComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
-#include "GameFramework/SpringArmComponent.h"
-#include "SpartaPlayerController.h"
-#include "GameFramework/Actor.h"
-#include "Components/WidgetComponent.h"
-#include "Components/TextBlock.h"
-#include "Components/ProgressBar.h"
-#include "SpartaGameState.h"
-
-ASpartaCharacter::ASpartaCharacter()
-{
-	PrimaryActorTick.bCanEverTick = false;
-	
-	SpringArmComp = CreateDefaultSubobject<USpringArmComponent>(TEXT("SpringArm"));
-	SpringArmComp->SetupAttachment(RootComponent);
-	SpringArmComp->TargetArmLength = 300.f;
-	SpringArmComp->bUsePawnControlRotation = true;
-
-	CameraComp = CreateDefaultSubobject<UCameraComponent>(TEXT("Camera"));
-	CameraComp->SetupAttachment(SpringArmComp, USpringArmComponent::SocketName);
-	CameraComp->bUsePawnControlRotation = false;
-
-	OverheadWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("OverheadWidget"));
-	OverheadWidget->SetupAttachment(GetMesh());
-	OverheadWidget->SetWidgetSpace(EWidgetSpace::Screen);
-
-	NormalSpeed = 600.f;
-	SprintSpeedMultiplier = 1.5f;
-	SprintSpeed = NormalSpeed * SprintSpeedMultiplier;
-
-	// CharacterMovement 설정
-	GetCharacterMovement()->MaxWalkSpeed = NormalSpeed;
-	GetCharacterMovement()->bOrientRotationToMovement = true;
-	GetCharacterMovement()->RotationRate = FRotator(0.f, 540.f, 0.f);
-	
-	// 컨트롤러 회전에 캐릭터가 영향받지 않도록 설정
-	bUseControllerRotationPitch = false;
-	bUseControllerRotationYaw = false;
-	bUseControllerRotationRoll = false;
-
-	MaxHealth = 100.f;
-	Health = MaxHealth;
-}
-
-void ASpartaCharacter::BeginPlay()
-{
-	Super::BeginPlay();
-	UpdateOverheadHP();
-}
-
-int32 ASpartaCharacter::GetHealth() const
-{
-	return FMath::RoundToInt(Health);
-}
-
-void ASpartaCharacter::AddHealth(int32 Amount)
-{
-	Health = FMath::Clamp(Health + Amount, 0.f, MaxHealth);
-	UpdateOverheadHP();
-}
-
-void ASpartaCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)	
-{
-	Super::SetupPlayerInputComponent(PlayerInputComponent);
-
-	if (UEnhancedInputComponent* EnhancedInput = Cast<UEnhancedInputComponent>(PlayerInputComponent))
-	{
-		if (ASpartaPlayerController* PlayerController = Cast<ASpartaPlayerController>(GetController()))
-		{
-			if (PlayerController->MoveAction)
-			{
-				EnhancedInput->BindAction(
-					PlayerController->MoveAction,
-					ETriggerEvent::Triggered,
-					this,
-					&ASpartaCharacter::Move);
-			}
-
-			if (PlayerController->JumpAction)
-			{
-				EnhancedInput->BindAction(
-					PlayerController->JumpAction,
-					ETriggerEvent::Triggered,
-					this,
-					&ASpartaCharacter::StartJump);
-
-				EnhancedInput->BindAction(
-					PlayerController->JumpAction,
-					ETriggerEvent::Completed,
-					this,
-					&ASpartaCharacter::StopJump);
-			}
-
-			if (PlayerController->LookAction)
-			{
-				EnhancedInput->BindAction(
-					PlayerController->LookAction,
-					ETriggerEvent::Triggered,
-					this,
-					&ASpartaCharacter::Look);
-			}
-
-			if (PlayerController->SprintAction)
-			{
-				EnhancedInput->BindAction(
-					PlayerController->SprintAction,
-					ETriggerEvent::Triggered,
-					this,
-					&ASpartaCharacter::StartSprint);
-
-				EnhancedInput->BindAction(
-					PlayerController->SprintAction,
-					ETriggerEvent::Completed,
-					this,
-					&ASpartaCharacter::StopSprint);
-			}
-		}
-	}
-}
-
-void ASpartaCharacter::Move(const FInputActionValue& value)
-{
-	if (!Controller)
-		return;
-
-	const FVector2D MoveInput = value.Get<FVector2D>();
-
-	// 컨트롤러 회전 기준 (카메라 방향)
-	const FRotator ControlRotation = Controller->GetControlRotation();
-	const FRotator YawRotation(0.f, ControlRotation.Yaw, 0.f);
-
-	// 전진 방향 벡터
-	const FVector ForwardDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X);
-	// 오른쪽 방향 벡터
-	const FVector RightDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
-
-	// W/S 입력
-	if (!FMath::IsNearlyZero(MoveInput.X))
-	{
-		AddMovementInput(ForwardDirection, MoveInput.X);
-	}
-
-	// A/D 입력
-	if (!FMath::IsNearlyZero(MoveInput.Y))
-	{
-		AddMovementInput(RightDirection, MoveInput.Y);
-	}
-}
-
-void ASpartaCharacter::StartJump(const FInputActionValue& value)
-{
-	if (value.Get<bool>())
-	{
-		Jump();
-	}
-}
-
-void ASpartaCharacter::StopJump(const FInputActionValue& value)
-{
-	if (!value.Get<bool>())
-	{
-		StopJumping();
-	}
-}
-
-void ASpartaCharacter::Look(const FInputActionValue& value)
-{
-	FVector2D LookInput = value.Get<FVector2D>();
-
-	AddControllerYawInput(LookInput.X);
-	AddControllerPitchInput(LookInput.Y);
-}
-
-void ASpartaCharacter::StartSprint(const FInputActionValue& value)
-{
-	if (GetCharacterMovement())
-	{
-		GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
-	}
-}
-
-void ASpartaCharacter::StopSprint(const FInputActionValue& value)
-{
-	if (GetCharacterMovement())
-	{
-		GetCharacterMovement()->MaxWalkSpeed = NormalSpeed;
-	}
-}
-
-void ASpartaCharacter::OnDeath()
-{
-	ASpartaGameState* SpartaGameState = GetWorld() ? GetWorld()->GetGameState<ASpartaGameState>() : nullptr;
-	if (SpartaGameState)
-	{
-		SpartaGameState->OnGameOver();
-	}
-}
-
-float ASpartaCharacter::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInsigator, AActor* DamageCauser)
-{
-	float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInsigator, DamageCauser);
-	
-	Health = FMath::Clamp(Health - DamageAmount, 0.f, MaxHealth);
-	UpdateOverheadHP();
-
-	if (Health <= 0.f)
-	{
-		OnDeath();
-	}
-	
-	return ActualDamage;
-}
-
-void ASpartaCharacter::UpdateOverheadHP()
-{
-	if (!OverheadWidget)
-		return;
-
-	UUserWidget* OverheadWidgetInstance = OverheadWidget->GetUserWidgetObject();
-	if (!OverheadWidgetInstance)
-		return;
-
-	// Progress Bar 업데이트
-	if (UProgressBar* HealthBar = Cast<UProgressBar>(OverheadWidgetInstance->GetWidgetFromName(TEXT("HealthBar"))))
-	{
-		float HealthPercent = Health / MaxHealth;
-		HealthBar->SetPercent(HealthPercent);
-		
-		// 체력에 따라 색상 변경 (선택사항)
-		FLinearColor BarColor;
-		if (HealthPercent > 0.6f)
-		{
-			BarColor = FLinearColor::Green;
-		}
-		else if (HealthPercent > 0.3f)
-		{
-			BarColor = FLinearColor::Yellow;
-		}
-		else
-		{
-			BarColor = FLinearColor::Red;
-		}
-		HealthBar->SetFillColorAndOpacity(BarColor);
-	}
-
-	// Text Block도 함께 업데이트 (선택사항)
-	if (UTextBlock* HPText = Cast<UTextBlock>(OverheadWidgetInstance->GetWidgetFromName(TEXT("OverHeadHP"))))
-	{
-		HPText->SetText(FText::FromString(FString::Printf(TEXT("%.0f / %.0f"), Health, MaxHealth)));
-	}
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaCharacter.h"
+#include "Camera/CameraComponent.h"
+#include "EnhancedInputComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/SpringArmComponent.h"
+#include "SpartaPlayerController.h"
+#include "GameFramework/Actor.h"
+#include "Components/WidgetComponent.h"
+#include "Components/TextBlock.h"
+#include "Components/ProgressBar.h"
+#include "SpartaGameState.h"
+#include "SpartaCollision.h"
+#include "Components/CapsuleComponent.h"
+
+ASpartaCharacter::ASpartaCharacter()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	
+	SpringArmComp = CreateDefaultSubobject<USpringArmComponent>(TEXT("SpringArm"));
+	SpringArmComp->SetupAttachment(RootComponent);
+	SpringArmComp->TargetArmLength = 300.f;
+	SpringArmComp->bUsePawnControlRotation = true;
+
+	CameraComp = CreateDefaultSubobject<UCameraComponent>(TEXT("Camera"));
+	CameraComp->SetupAttachment(SpringArmComp, USpringArmComponent::SocketName);
+	CameraComp->bUsePawnControlRotation = false;
+
+	OverheadWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("OverheadWidget"));
+	OverheadWidget->SetupAttachment(GetMesh());
+	OverheadWidget->SetWidgetSpace(EWidgetSpace::Screen);
+
+	NormalSpeed = 600.f;
+	SprintSpeedMultiplier = 1.5f;
+	SprintSpeed = NormalSpeed * SprintSpeedMultiplier;
+
+	// CharacterMovement 설정
+	GetCharacterMovement()->MaxWalkSpeed = NormalSpeed;
+	GetCharacterMovement()->bOrientRotationToMovement = true;
+	GetCharacterMovement()->RotationRate = FRotator(0.f, 540.f, 0.f);
+	
+	// 컨트롤러 회전에 캐릭터가 영향받지 않도록 설정
+	bUseControllerRotationPitch = false;
+	bUseControllerRotationYaw = false;
+	bUseControllerRotationRoll = false;
+
+	// 아이템 픽업 구(Pickup 채널)는 플레이어 캡슐하고만 Overlap
+	GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Pickup, ECR_Overlap);
+
+	MaxHealth = 100.f;
+	Health = MaxHealth;
+}
+
+void ASpartaCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+	UpdateOverheadHP();
+}
+
+int32 ASpartaCharacter::GetHealth() const
+{
+	return FMath::RoundToInt(Health);
+}
+
+void ASpartaCharacter::AddHealth(int32 Amount)
+{
+	Health = FMath::Clamp(Health + Amount, 0.f, MaxHealth);
+	UpdateOverheadHP();
+}
+
+void ASpartaCharacter::ResetHealth()
+{
+	Health = MaxHealth;
+	UpdateOverheadHP();
+}
+
+void ASpartaCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)	
+{
+	Super::SetupPlayerInputComponent(PlayerInputComponent);
+
+	if (UEnhancedInputComponent* EnhancedInput = Cast<UEnhancedInputComponent>(PlayerInputComponent))
+	{
+		if (ASpartaPlayerController* PlayerController = Cast<ASpartaPlayerController>(GetController()))
+		{
+			if (PlayerController->MoveAction)
+			{
+				EnhancedInput->BindAction(
+					PlayerController->MoveAction,
+					ETriggerEvent::Triggered,
+					this,
+					&ASpartaCharacter::Move);
+			}
+
+			if (PlayerController->JumpAction)
+			{
+				EnhancedInput->BindAction(
+					PlayerController->JumpAction,
+					ETriggerEvent::Triggered,
+					this,
+					&ASpartaCharacter::StartJump);
+
+				EnhancedInput->BindAction(
+					PlayerController->JumpAction,
+					ETriggerEvent::Completed,
+					this,
+					&ASpartaCharacter::StopJump);
+			}
+
+			if (PlayerController->LookAction)
+			{
+				EnhancedInput->BindAction(
+					PlayerController->LookAction,
+					ETriggerEvent::Triggered,
+					this,
+					&ASpartaCharacter::Look);
+			}
+
+			if (PlayerController->SprintAction)
+			{
+				EnhancedInput->BindAction(
+					PlayerController->SprintAction,
+					ETriggerEvent::Triggered,
+					this,
+					&ASpartaCharacter::StartSprint);
+
+				EnhancedInput->BindAction(
+					PlayerController->SprintAction,
+					ETriggerEvent::Completed,
+					this,
+					&ASpartaCharacter::StopSprint);
+			}
+		}
+	}
+}
+
+void ASpartaCharacter::Move(const FInputActionValue& value)
+{
+	if (!Controller)
+		return;
+
+	const FVector2D MoveInput = value.Get<FVector2D>();
+
+	// 컨트롤러 회전 기준 (카메라 방향)
+	const FRotator ControlRotation = Controller->GetControlRotation();
+	const FRotator YawRotation(0.f, ControlRotation.Yaw, 0.f);
+
+	// 전진 방향 벡터
+	const FVector ForwardDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X);
+	// 오른쪽 방향 벡터
+	const FVector RightDirection = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
+
+	// W/S 입력
+	if (!FMath::IsNearlyZero(MoveInput.X))
+	{
+		AddMovementInput(ForwardDirection, MoveInput.X);
+	}
+
+	// A/D 입력
+	if (!FMath::IsNearlyZero(MoveInput.Y))
+	{
+		AddMovementInput(RightDirection, MoveInput.Y);
+	}
+}
+
+void ASpartaCharacter::StartJump(const FInputActionValue& value)
+{
+	if (value.Get<bool>())
+	{
+		Jump();
+	}
+}
+
+void ASpartaCharacter::StopJump(const FInputActionValue& value)
+{
+	if (!value.Get<bool>())
+	{
+		StopJumping();
+	}
+}
+
+void ASpartaCharacter::Look(const FInputActionValue& value)
+{
+	FVector2D LookInput = value.Get<FVector2D>();
+
+	AddControllerYawInput(LookInput.X);
+	AddControllerPitchInput(LookInput.Y);
+}
+
+void ASpartaCharacter::StartSprint(const FInputActionValue& value)
+{
+	if (GetCharacterMovement())
+	{
+		GetCharacterMovement()->MaxWalkSpeed = SprintSpeed;
+	}
+}
+
+void ASpartaCharacter::StopSprint(const FInputActionValue& value)
+{
+	if (GetCharacterMovement())
+	{
+		GetCharacterMovement()->MaxWalkSpeed = NormalSpeed;
+	}
+}
+
+void ASpartaCharacter::OnDeath()
+{
+	ASpartaGameState* SpartaGameState = GetWorld() ? GetWorld()->GetGameState<ASpartaGameState>() : nullptr;
+	if (SpartaGameState)
+	{
+		SpartaGameState->OnGameOver();
+	}
+}
+
+float ASpartaCharacter::TakeDamage(float DamageAmount, FDamageEvent const& DamageEvent, AController* EventInsigator, AActor* DamageCauser)
+{
+	float ActualDamage = Super::TakeDamage(DamageAmount, DamageEvent, EventInsigator, DamageCauser);
+	
+	Health = FMath::Clamp(Health - DamageAmount, 0.f, MaxHealth);
+	UpdateOverheadHP();
+
+	if (Health <= 0.f)
+	{
+		OnDeath();
+	}
+	
+	return ActualDamage;
+}
+
+void ASpartaCharacter::UpdateOverheadHP()
+{
+	if (!OverheadWidget)
+		return;
+
+	UUserWidget* OverheadWidgetInstance = OverheadWidget->GetUserWidgetObject();
+	if (!OverheadWidgetInstance)
+		return;
+
+	// Progress Bar 업데이트
+	if (UProgressBar* HealthBar = Cast<UProgressBar>(OverheadWidgetInstance->GetWidgetFromName(TEXT("HealthBar"))))
+	{
+		float HealthPercent = Health / MaxHealth;
+		HealthBar->SetPercent(HealthPercent);
+		
+		// 체력에 따라 색상 변경 (선택사항)
+		FLinearColor BarColor;
+		if (HealthPercent > 0.6f)
+		{
+			BarColor = FLinearColor::Green;
+		}
+		else if (HealthPercent > 0.3f)
+		{
+			BarColor = FLinearColor::Yellow;
+		}
+		else
+		{
+			BarColor = FLinearColor::Red;
+		}
+		HealthBar->SetFillColorAndOpacity(BarColor);
+	}
+
+	// Text Block도 함께 업데이트 (선택사항)
+	if (UTextBlock* HPText = Cast<UTextBlock>(OverheadWidgetInstance->GetWidgetFromName(TEXT("OverHeadHP"))))
+	{
+		HPText->SetText(FText::FromString(FString::Printf(TEXT("%.0f / %.0f"), Health, MaxHealth)));
+	}
 }
\ No newline at end of file
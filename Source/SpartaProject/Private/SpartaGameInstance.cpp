@@ -1,15 +1,29 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SpartaGameInstance.h"
-
-USpartaGameInstance::USpartaGameInstance()
-{
-	TotalScore = 0;
-	CurrentLevelIndex = 0;
-}
-
-void USpartaGameInstance::AddToScore(int32 Amount)
-{
-	TotalScore += Amount;
-	UE_LOG(LogTemp, Warning, TEXT("Total Score Updated: %d"), TotalScore);
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaGameInstance.h"
+
+USpartaGameInstance::USpartaGameInstance()
+{
+	TotalScore = 0;
+	CurrentLevelIndex = 0;
+	SpawnSeed = 0;
+	LevelTransitionStartTime = 0.0;
+}
+
+void USpartaGameInstance::Init()
+{
+	Super::Init();
+
+	// 커맨드라인으로 시드를 받지 못하면 무작위 시드를 쓰고, 재현할 수 있도록 로그에 남김
+	if (!FParse::Value(FCommandLine::Get(), TEXT("SpartaSeed="), SpawnSeed))
+	{
+		SpawnSeed = FMath::Rand();
+	}
+	UE_LOG(LogTemp, Warning, TEXT("Spawn Seed: %d (use -SpartaSeed=%d to reproduce)"), SpawnSeed, SpawnSeed);
+}
+
+void USpartaGameInstance::AddToScore(int32 Amount)
+{
+	TotalScore += Amount;
+	UE_LOG(LogTemp, Warning, TEXT("Total Score Updated: %d"), TotalScore);
+}
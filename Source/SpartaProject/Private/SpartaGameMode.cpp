@@ -1,14 +1,16 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SpartaGameMode.h"
-#include "SpartaCharacter.h"
-#include "SpartaPlayerController.h"
-#include "SpartaGameState.h"
-
-ASpartaGameMode::ASpartaGameMode()
-{
-	PrimaryActorTick.bCanEverTick = false;
-	DefaultPawnClass = ASpartaCharacter::StaticClass();
-	PlayerControllerClass = ASpartaPlayerController::StaticClass();
-	GameStateClass = ASpartaGameState::StaticClass();
-}
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaGameMode.h"
+#include "SpartaCharacter.h"
+#include "SpartaPlayerController.h"
+#include "SpartaGameState.h"
+
+ASpartaGameMode::ASpartaGameMode()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	DefaultPawnClass = ASpartaCharacter::StaticClass();
+	PlayerControllerClass = ASpartaPlayerController::StaticClass();
+	GameStateClass = ASpartaGameState::StaticClass();
+	// 레벨 전환 시 ServerTravel로 플레이어 컨트롤러와 HUD를 유지한 채 다음 맵을 백그라운드에서 로드
+	bUseSeamlessTravel = true;
+}
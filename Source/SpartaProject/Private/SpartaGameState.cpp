@@ -1,345 +1,891 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SpartaGameState.h"
-#include "SpartaGameInstance.h"
-#include "SpartaPlayerController.h"
-#include "Kismet/GameplayStatics.h"
-#include "SpawnVolume.h"
-#include "CoinItem.h"
-#include "Components/TextBlock.h"
-#include "Blueprint/UserWidget.h"
-
-ASpartaGameState::ASpartaGameState()
-{
-	Score = 0;
-	SpawnedCoinCount = 0;
-	CollectedCoinCount = 0;
-	LevelDuration = 30.f;
-	CurrentLevelIndex = 0;
-	MaxLevels = 3;
-	CurrentWaveIndex = 0;
-	MaxWavesPerLevel = 3;
-
-	// 기본 웨이브 정보 설정 (3개 레벨 x 3개 웨이브 = 9개)
-	// Level 1 - BasicLevel
-	WaveInfos.Add(FWaveInfo(20, 30.f));  // Wave 1: 20개 아이템, 30초
-	WaveInfos.Add(FWaveInfo(30, 25.f));  // Wave 2: 30개 아이템, 25초
-	WaveInfos.Add(FWaveInfo(40, 20.f));  // Wave 3: 40개 아이템, 20초
-
-	// Level 2 - IntermediateLevel
-	WaveInfos.Add(FWaveInfo(30, 25.f));  // Wave 1: 30개 아이템, 25초
-	WaveInfos.Add(FWaveInfo(40, 20.f));  // Wave 2: 40개 아이템, 20초
-	WaveInfos.Add(FWaveInfo(50, 18.f));  // Wave 3: 50개 아이템, 18초
-
-	// Level 3 - AdvancedLevel
-	WaveInfos.Add(FWaveInfo(40, 20.f));  // Wave 1: 40개 아이템, 20초
-	WaveInfos.Add(FWaveInfo(50, 18.f));  // Wave 2: 50개 아이템, 18초
-	WaveInfos.Add(FWaveInfo(60, 15.f));  // Wave 3: 60개 아이템, 15초
-}
-
-void ASpartaGameState::BeginPlay()
-{
-	Super::BeginPlay();
-
-	StartLevel();
-
-	GetWorldTimerManager().SetTimer(
-		HUDUpdateTimerHandle,
-		this,
-		&ASpartaGameState::UpdateHUD,
-		0.1f,
-		true);
-}
-
-int32 ASpartaGameState::GetScore() const
-{
-	return Score;
-}
-
-void ASpartaGameState::AddScore(int32 Amount)
-{
-	if (UGameInstance* GameInstance = GetGameInstance())
-	{
-		USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
-		if (SpartaGameInstance)
-		{
-			SpartaGameInstance->AddToScore(Amount);
-		}
-	}
-}
-
-void ASpartaGameState::StartLevel()
-{
-	if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
-	{
-		if (ASpartaPlayerController* SpartaPlayerController = Cast<ASpartaPlayerController>(PlayerController))
-		{
-			SpartaPlayerController->ShowGameHUD();
-		}
-	}
-
-	if (UGameInstance* GameInstance = GetGameInstance())
-	{
-		USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
-		if (SpartaGameInstance)
-		{
-			CurrentLevelIndex = SpartaGameInstance->CurrentLevelIndex;
-		}
-	}
-
-	// 현재 레벨의 첫 번째 웨이브부터 시작
-	CurrentWaveIndex = 0;
-	StartWave();
-}
-
-void ASpartaGameState::StartWave()
-{
-	SpawnedCoinCount = 0;
-	CollectedCoinCount = 0;
-
-	// 현재 레벨과 웨이브에 맞는 인덱스 계산
-	int32 WaveInfoIndex = (CurrentLevelIndex * MaxWavesPerLevel) + CurrentWaveIndex;
-
-	if (!WaveInfos.IsValidIndex(WaveInfoIndex))
-	{
-		UE_LOG(LogTemp, Error, TEXT("[GameState] Invalid WaveInfo index: %d"), WaveInfoIndex);
-		return;
-	}
-
-	FWaveInfo CurrentWave = WaveInfos[WaveInfoIndex];
-
-	// 화면에 웨이브 시작 알림 표시
-	FString WaveMessage = FString::Printf(TEXT("Level %d - Wave %d 시작!"), 
-		CurrentLevelIndex + 1, CurrentWaveIndex + 1);
-	
-	GEngine->AddOnScreenDebugMessage(
-		-1, 
-		3.f, 
-		FColor::Yellow, 
-		WaveMessage, 
-		true, 
-		FVector2D(2.f, 2.f)
-	);
-
-	UE_LOG(LogTemp, Warning, TEXT("[GameState] %s - Items: %d, Duration: %.1f"), 
-		*WaveMessage, CurrentWave.ItemCount, CurrentWave.Duration);
-
-	// SpawnVolume 찾기 및 DataTable 설정
-	TArray<AActor*> FoundVolumes;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASpawnVolume::StaticClass(), FoundVolumes);
-
-	if (FoundVolumes.Num() > 0)
-	{
-		ASpawnVolume* SpawnVolume = Cast<ASpawnVolume>(FoundVolumes[0]);
-		if (SpawnVolume)
-		{
-			// 현재 레벨/웨이브에 맞는 DataTable 설정
-			SpawnVolume->SetCurrentDataTableIndex(CurrentLevelIndex, CurrentWaveIndex);
-
-			// 아이템 스폰
-			for (int32 i = 0; i < CurrentWave.ItemCount; i++)
-			{
-				AActor* SpawnedActor = SpawnVolume->SpawnRandomItem();
-				// 만약 스폰된 액터가 코인 타입이라면 SpawnedCoinCount 증가
-				if (SpawnedActor && SpawnedActor->IsA(ACoinItem::StaticClass()))
-				{
-					SpawnedCoinCount++;
-				}
-			}
-		}
-	}
-
-	// 웨이브 타이머 설정
-	GetWorldTimerManager().SetTimer(
-		LevelTimerHandle,
-		this,
-		&ASpartaGameState::OnWaveTimeUp,
-		CurrentWave.Duration,
-		false);
-
-	UpdateHUD();
-
-	UE_LOG(LogTemp, Warning, TEXT("Level %d - Wave %d Start! Spawned %d coins"),
-		CurrentLevelIndex + 1, CurrentWaveIndex + 1, SpawnedCoinCount);
-}
-
-void ASpartaGameState::OnLevelTimeUp()
-{
-	// 기존 함수 호환성 유지
-	OnWaveTimeUp();
-}
-
-void ASpartaGameState::OnWaveTimeUp()
-{
-	UE_LOG(LogTemp, Warning, TEXT("[GameState] Wave %d time's up!"), CurrentWaveIndex + 1);
-	CheckWaveCompletion();
-}
-
-void ASpartaGameState::OnCoinCollected()
-{
-	CollectedCoinCount++;
-
-	UE_LOG(LogTemp, Warning, TEXT("Coin Collected! Total: %d / %d"),
-		CollectedCoinCount, SpawnedCoinCount);
-
-	if (SpawnedCoinCount > 0 && CollectedCoinCount >= SpawnedCoinCount)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[GameState] All coins collected in Wave %d!"), CurrentWaveIndex + 1);
-		CheckWaveCompletion();
-	}
-}
-
-void ASpartaGameState::CheckWaveCompletion()
-{
-	// 타이머 해제
-	GetWorldTimerManager().ClearTimer(LevelTimerHandle);
-
-	CurrentWaveIndex++;
-
-	// 현재 레벨의 모든 웨이브를 완료했는지 확인
-	if (CurrentWaveIndex >= MaxWavesPerLevel)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[GameState] Level %d completed! All waves finished."), CurrentLevelIndex + 1);
-		
-		// 화면에 레벨 완료 메시지 표시
-		GEngine->AddOnScreenDebugMessage(
-			-1, 
-			3.f, 
-			FColor::Green, 
-			FString::Printf(TEXT("Level %d 완료!"), CurrentLevelIndex + 1), 
-			true, 
-			FVector2D(2.f, 2.f)
-		);
-
-		EndLevel();
-	}
-	else
-	{
-		// 다음 웨이브 시작
-		UE_LOG(LogTemp, Warning, TEXT("[GameState] Wave %d completed! Starting next wave..."), CurrentWaveIndex);
-		
-		// 화면에 웨이브 완료 메시지 표시
-		GEngine->AddOnScreenDebugMessage(
-			-1, 
-			2.f, 
-			FColor::Cyan, 
-			FString::Printf(TEXT("Wave %d 완료! 다음 웨이브 준비..."), CurrentWaveIndex), 
-			true, 
-			FVector2D(2.f, 2.f)
-		);
-
-		// 짧은 딜레이 후 다음 웨이브 시작
-		FTimerHandle NextWaveTimerHandle;
-		GetWorldTimerManager().SetTimer(
-			NextWaveTimerHandle,
-			this,
-			&ASpartaGameState::StartWave,
-			2.0f,
-			false);
-	}
-}
-
-void ASpartaGameState::EndLevel()
-{
-	if (UGameInstance* GameInstance = GetGameInstance())
-	{
-		USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
-		if (SpartaGameInstance)
-		{
-			// 다음 레벨로 이동
-			CurrentLevelIndex++;
-			SpartaGameInstance->CurrentLevelIndex = CurrentLevelIndex;
-
-			UE_LOG(LogTemp, Warning, TEXT("[GameState] EndLevel - Moving to level index: %d"), CurrentLevelIndex);
-
-			// 모든 레벨을 다 돌았다면 게임 오버
-			if (CurrentLevelIndex >= MaxLevels)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[GameState] All levels completed! Game Over!"));
-				OnGameOver();
-				return;
-			}
-
-			// 레벨 맵 이름이 있다면 해당 맵 불러오기
-			if (LevelMapNames.IsValidIndex(CurrentLevelIndex))
-			{
-				FName NextLevelName = LevelMapNames[CurrentLevelIndex];
-				UE_LOG(LogTemp, Warning, TEXT("[GameState] Opening next level: %s"), *NextLevelName.ToString());
-				UGameplayStatics::OpenLevel(GetWorld(), NextLevelName);
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("[GameState] No level name found for index %d! Going to Game Over."), CurrentLevelIndex);
-				OnGameOver();
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("[GameState] Failed to cast to SpartaGameInstance!"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("[GameState] GameInstance is NULL!"));
-	}
-}
-
-void ASpartaGameState::OnGameOver()
-{
-	UE_LOG(LogTemp, Warning, TEXT("[GameState] Game Over called"));
-	
-	// 화면에 게임 오버 메시지 표시
-	GEngine->AddOnScreenDebugMessage(
-		-1, 
-		5.f, 
-		FColor::Red, 
-		TEXT("모든 레벨 완료! Game Over!"), 
-		true, 
-		FVector2D(2.5f, 2.5f)
-	);
-
-	if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
-	{
-		if (ASpartaPlayerController* SpartaPlayerController = Cast<ASpartaPlayerController>(PlayerController))
-		{
-			SpartaPlayerController->SetPause(true);
-			SpartaPlayerController->ShowMainMenu(true);
-		}
-	}
-}
-
-void ASpartaGameState::UpdateHUD()
-{
-	if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
-	{
-		if (ASpartaPlayerController* SpartaPlayerController = Cast<ASpartaPlayerController>(PlayerController))
-		{
-			if (UUserWidget* HUDWidget = SpartaPlayerController->GetHUDWidget())
-			{
-				if (UTextBlock* TimeText = Cast<UTextBlock>(HUDWidget->GetWidgetFromName(TEXT("Time"))))
-				{
-					float RemainingTime = GetWorldTimerManager().GetTimerRemaining(LevelTimerHandle);
-					TimeText->SetText(FText::FromString(FString::Printf(TEXT("Time: %.1f"), RemainingTime)));
-				}
-
-				if (UTextBlock* ScoreText = Cast<UTextBlock>(HUDWidget->GetWidgetFromName(TEXT("Score"))))
-				{
-					if (UGameInstance* GameInstance = GetGameInstance())
-					{
-						USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
-						if (SpartaGameInstance)
-						{
-							ScoreText->SetText(FText::FromString(FString::Printf(TEXT("Score: %d"), SpartaGameInstance->TotalScore)));
-						}
-					}
-				}
-
-				if (UTextBlock* LevelIndexText = Cast<UTextBlock>(HUDWidget->GetWidgetFromName(TEXT("Level"))))
-				{
-					LevelIndexText->SetText(FText::FromString(FString::Printf(TEXT("Level %d - Wave %d"), 
-						CurrentLevelIndex + 1, CurrentWaveIndex + 1)));
-				}
-			}
-		}
-	}
-}
\ No newline at end of file
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaGameState.h"
+#include "SpartaGameInstance.h"
+#include "SpartaPlayerController.h"
+#include "SpartaCharacter.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/GameModeBase.h"
+#include "Engine/LevelStreaming.h"
+#include "GameFramework/PlayerStart.h"
+#include "Blueprint/UserWidget.h"
+#include "SpawnVolume.h"
+#include "SpawnVolumeSubsystem.h"
+#include "CoinItem.h"
+#include "SpartaStats.h"
+#include "WaveMetricsSubsystem.h"
+#include "ItemMassSubsystem.h"
+#include "Async/Async.h"
+
+ASpartaGameState::ASpartaGameState()
+{
+	Score = 0;
+	SpawnedCoinCount = 0;
+	CollectedCoinCount = 0;
+	LevelDuration = 30.f;
+	CurrentLevelIndex = 0;
+	MaxLevels = 3;
+	CurrentWaveIndex = 0;
+	MaxWavesPerLevel = 3;
+	bTimeSlicedSpawning = true;
+	SpawnBudgetMs = 2.f;
+	bWavePopulated = false;
+	NextPendingSpawnIndex = 0;
+	NumPendingPointBatches = 0;
+	SpawnWaveSerial = 0;
+	PreparedLevelIndex = INDEX_NONE;
+	PreparedWaveIndex = INDEX_NONE;
+	NumRecentPickups = 0;
+	bUseStreamedLevels = false;
+	bWaveLoopSuspended = false;
+	WaveEndTime = 0.f;
+	DisplayedTimeTenths = INDEX_NONE;
+
+	// 기본 웨이브 정보 설정 (3개 레벨 x 3개 웨이브 = 9개)
+	// Level 1 - BasicLevel
+	WaveInfos.Add(FWaveInfo(20, 30.f));  // Wave 1: 20개 아이템, 30초
+	WaveInfos.Add(FWaveInfo(30, 25.f));  // Wave 2: 30개 아이템, 25초
+	WaveInfos.Add(FWaveInfo(40, 20.f));  // Wave 3: 40개 아이템, 20초
+
+	// Level 2 - IntermediateLevel
+	WaveInfos.Add(FWaveInfo(30, 25.f));  // Wave 1: 30개 아이템, 25초
+	WaveInfos.Add(FWaveInfo(40, 20.f));  // Wave 2: 40개 아이템, 20초
+	WaveInfos.Add(FWaveInfo(50, 18.f));  // Wave 3: 50개 아이템, 18초
+
+	// Level 3 - AdvancedLevel
+	WaveInfos.Add(FWaveInfo(40, 20.f));  // Wave 1: 40개 아이템, 20초
+	WaveInfos.Add(FWaveInfo(50, 18.f));  // Wave 2: 50개 아이템, 18초
+	WaveInfos.Add(FWaveInfo(60, 15.f));  // Wave 3: 60개 아이템, 15초
+}
+
+void ASpartaGameState::BeginPlay()
+{
+	Super::BeginPlay();
+
+	StartLevel();
+
+	GetWorldTimerManager().SetTimer(
+		HUDUpdateTimerHandle,
+		this,
+		&ASpartaGameState::UpdateTimeHUD,
+		0.1f,
+		true);
+
+#if STATS
+	GetWorldTimerManager().SetTimer(
+		PickupRateTimerHandle,
+		this,
+		&ASpartaGameState::UpdatePickupRate,
+		1.0f,
+		true);
+#endif
+}
+
+int32 ASpartaGameState::GetScore() const
+{
+	return Score;
+}
+
+void ASpartaGameState::AddScore(int32 Amount)
+{
+	if (bWaveLoopSuspended)
+		return;
+
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
+		if (SpartaGameInstance)
+		{
+			SpartaGameInstance->AddToScore(Amount);
+		}
+	}
+
+	UpdateScoreHUD();
+}
+
+void ASpartaGameState::StartLevel()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
+		if (SpartaGameInstance)
+		{
+			CurrentLevelIndex = SpartaGameInstance->CurrentLevelIndex;
+		}
+	}
+
+	// 레벨 전환 중이면 표시가 끝난 뒤 다시 호출됨
+	if (PendingShownLevel.IsValid())
+		return;
+
+	// 스트리밍 레벨을 쓰는데 현재 레벨이 아직 보이지 않으면 먼저 표시
+	ULevelStreaming* CurrentStreamingLevel = GetStreamingLevel(CurrentLevelIndex);
+	if (CurrentStreamingLevel && !CurrentStreamingLevel->IsLevelVisible())
+	{
+		TransitionToStreamedLevel(CurrentLevelIndex);
+		return;
+	}
+
+	ReportLevelTransition();
+
+	if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+	{
+		if (ASpartaPlayerController* SpartaPlayerController = Cast<ASpartaPlayerController>(PlayerController))
+		{
+			// 레벨이 바뀌어도 HUD가 남아있으면 다시 만들지 않고 내용만 갱신
+			// (맵을 옮기면 플레이어 컨트롤러가 유지되어도 위젯은 뷰포트에서 빠지므로 다시 만듦)
+			UUserWidget* HUDWidget = SpartaPlayerController->GetHUDWidget();
+			if (HUDWidget && HUDWidget->IsInViewport())
+			{
+				UpdateHUD();
+			}
+			else
+			{
+				SpartaPlayerController->ShowGameHUD();
+			}
+		}
+	}
+
+	// 현재 레벨의 첫 번째 웨이브부터 시작
+	CurrentWaveIndex = 0;
+	StartWave();
+}
+
+void ASpartaGameState::StartWave()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_StartWave);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpartaGameState::StartWave);
+
+	if (bWaveLoopSuspended)
+		return;
+
+	SpawnedCoinCount = 0;
+	CollectedCoinCount = 0;
+	bWavePopulated = false;
+	SET_DWORD_STAT(STAT_Sparta_SpawnsPerWave, 0);
+	CancelPendingSpawns();
+
+	// 현재 레벨과 웨이브에 맞는 인덱스 계산
+	int32 WaveInfoIndex = (CurrentLevelIndex * MaxWavesPerLevel) + CurrentWaveIndex;
+
+	if (!WaveInfos.IsValidIndex(WaveInfoIndex))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GameState] Invalid WaveInfo index: %d"), WaveInfoIndex);
+		return;
+	}
+
+	FWaveInfo CurrentWave = WaveInfos[WaveInfoIndex];
+
+	if (UWaveMetricsSubsystem* MetricsSubsystem = GetWorld()->GetSubsystem<UWaveMetricsSubsystem>())
+	{
+		MetricsSubsystem->BeginWave(CurrentLevelIndex, CurrentWaveIndex, CurrentWave.ItemCount, CurrentWave.Duration);
+	}
+
+	// 화면에 웨이브 시작 알림 표시
+	FString WaveMessage = FString::Printf(TEXT("Level %d - Wave %d 시작!"), 
+		CurrentLevelIndex + 1, CurrentWaveIndex + 1);
+	
+	GEngine->AddOnScreenDebugMessage(
+		-1, 
+		3.f, 
+		FColor::Yellow, 
+		WaveMessage, 
+		true, 
+		FVector2D(2.f, 2.f)
+	);
+
+	UE_LOG(LogTemp, Warning, TEXT("[GameState] %s - Items: %d, Duration: %.1f"), 
+		*WaveMessage, CurrentWave.ItemCount, CurrentWave.Duration);
+
+	// 웨이브 사이 대기 시간 동안 계산해둔 매니페스트가 없으면 (레벨 첫 웨이브 등) 지금 계산 시작
+	if (PreparedLevelIndex != CurrentLevelIndex || PreparedWaveIndex != CurrentWaveIndex)
+	{
+		PrepareWaveManifests(CurrentLevelIndex, CurrentWaveIndex);
+	}
+
+	// 볼륨마다 매니페스트를 받아 바닥 보정을 요청하고, 결과가 도착하는 대로 스폰
+	for (FPreparedManifest& Prepared : PreparedManifests)
+	{
+		ASpawnVolume* SpawnVolume = Prepared.Volume.Get();
+		if (!SpawnVolume)
+			continue;
+
+		NumPendingPointBatches++;
+		const TWeakObjectPtr<ASpawnVolume> WeakSpawnVolume(SpawnVolume);
+		FOnManifestReady OnReady = FOnManifestReady::CreateUObject(this, &ASpartaGameState::OnWaveManifestReady, WeakSpawnVolume, SpawnWaveSerial);
+
+		// 보통은 대기 시간 동안 이미 끝나 있어 바로 넘김
+		if (Prepared.Manifest.IsReady())
+		{
+			SpawnVolume->ResolveManifest(Prepared.Manifest.Consume(), MoveTemp(OnReady));
+			continue;
+		}
+
+		// 아직 계산 중이면 게임 스레드를 막지 않고, 계산이 끝난 뒤 게임 스레드에서 이어서 바닥 보정
+		Prepared.Manifest.Then([WeakSpawnVolume, OnReady = MoveTemp(OnReady)](TFuture<FWaveManifest> Future) mutable
+		{
+			AsyncTask(ENamedThreads::GameThread, [WeakSpawnVolume, OnReady = MoveTemp(OnReady), Manifest = Future.Consume()]() mutable
+			{
+				if (ASpawnVolume* ReadySpawnVolume = WeakSpawnVolume.Get())
+				{
+					ReadySpawnVolume->ResolveManifest(MoveTemp(Manifest), MoveTemp(OnReady));
+				}
+			});
+		});
+	}
+	PreparedManifests.Reset();
+	PreparedLevelIndex = INDEX_NONE;
+	PreparedWaveIndex = INDEX_NONE;
+
+	if (USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>())
+	{
+		const TArray<TObjectPtr<ASpawnVolume>>& Volumes = VolumeSubsystem->GetVolumes();
+
+		// 마지막 웨이브 동안 다음 레벨을 미리 로드
+		if (CurrentWaveIndex == MaxWavesPerLevel - 1)
+		{
+			PreloadNextLevel();
+		}
+
+		// 이번 웨이브 동안 다음 웨이브의 DataTable과 아이템 클래스를 미리 로드 (다음 레벨은 다른 맵이라 제외)
+		if (CurrentWaveIndex + 1 < MaxWavesPerLevel)
+		{
+			for (ASpawnVolume* SpawnVolume : Volumes)
+			{
+				if (SpawnVolume)
+				{
+					SpawnVolume->PreloadDataTable(CurrentLevelIndex, CurrentWaveIndex + 1);
+				}
+			}
+		}
+	}
+
+	// 스폰할 볼륨이 하나도 없으면 빈 웨이브로 바로 완료 처리
+	if (NumPendingPointBatches == 0)
+	{
+		SpawnWaveSlice();
+	}
+
+	// 웨이브 타이머 설정
+	GetWorldTimerManager().SetTimer(
+		LevelTimerHandle,
+		this,
+		&ASpartaGameState::OnWaveTimeUp,
+		CurrentWave.Duration,
+		false);
+	WaveEndTime = GetWorld()->GetTimeSeconds() + CurrentWave.Duration;
+
+	UpdateLevelHUD();
+	UpdateTimeHUD();
+}
+
+void ASpartaGameState::PrepareWaveManifests(int32 LevelIndex, int32 WaveIndex)
+{
+	PreparedManifests.Reset();
+	PreparedLevelIndex = LevelIndex;
+	PreparedWaveIndex = WaveIndex;
+
+	const int32 WaveInfoIndex = (LevelIndex * MaxWavesPerLevel) + WaveIndex;
+	if (!WaveInfos.IsValidIndex(WaveInfoIndex))
+		return;
+
+	USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>();
+	if (!VolumeSubsystem)
+		return;
+
+	// 등록된 SpawnVolume들에 웨이브 아이템을 가중치 비율로 분배
+	const TArray<TObjectPtr<ASpawnVolume>>& Volumes = VolumeSubsystem->GetVolumes();
+	TArray<int32> VolumeItemCounts;
+	VolumeSubsystem->DistributeItemCount(WaveInfos[WaveInfoIndex].ItemCount, VolumeItemCounts);
+
+	for (int32 i = 0; i < Volumes.Num(); i++)
+	{
+		ASpawnVolume* SpawnVolume = Volumes[i];
+		if (!SpawnVolume || VolumeItemCounts[i] <= 0)
+			continue;
+
+		FPreparedManifest& Prepared = PreparedManifests.AddDefaulted_GetRef();
+		Prepared.Volume = SpawnVolume;
+		Prepared.Manifest = SpawnVolume->BuildWaveManifestAsync(LevelIndex, WaveIndex, VolumeItemCounts[i], GetWaveSeed(LevelIndex, WaveIndex, i));
+	}
+}
+
+int32 ASpartaGameState::GetWaveSeed(int32 LevelIndex, int32 WaveIndex, int32 VolumeIndex) const
+{
+	int32 SessionSeed = 0;
+	if (const USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GetGameInstance()))
+	{
+		SessionSeed = SpartaGameInstance->SpawnSeed;
+	}
+
+	uint32 WaveSeed = HashCombine(GetTypeHash(SessionSeed), GetTypeHash(LevelIndex));
+	WaveSeed = HashCombine(WaveSeed, GetTypeHash(WaveIndex));
+	WaveSeed = HashCombine(WaveSeed, GetTypeHash(VolumeIndex));
+	return static_cast<int32>(WaveSeed);
+}
+
+void ASpartaGameState::OnWaveManifestReady(const TArray<FWaveManifestEntry>& Entries, TWeakObjectPtr<ASpawnVolume> WeakSpawnVolume, int32 WaveSerial)
+{
+	// 이미 끝난 웨이브의 결과는 무시
+	if (WaveSerial != SpawnWaveSerial)
+		return;
+
+	NumPendingPointBatches--;
+
+	PendingSpawns.Reserve(PendingSpawns.Num() + Entries.Num());
+	for (const FWaveManifestEntry& Entry : Entries)
+	{
+		PendingSpawns.Add({ WeakSpawnVolume, Entry.ItemClass, Entry.Location, Entry.Rotation });
+	}
+
+	// 이미 다음 프레임 스폰이 예약되어 있으면 거기서 이어서 처리
+	if (!GetWorldTimerManager().TimerExists(SpawnSliceTimerHandle))
+	{
+		SpawnWaveSlice();
+	}
+}
+
+void ASpartaGameState::SpawnWaveSlice()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_SpawnWaveSlice);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpartaGameState::SpawnWaveSlice);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = SpawnBudgetMs * 0.001;
+	UItemMassSubsystem* MassSubsystem = GetWorld()->GetSubsystem<UItemMassSubsystem>();
+
+	while (PendingSpawns.IsValidIndex(NextPendingSpawnIndex))
+	{
+		const FPendingItemSpawn& PendingSpawn = PendingSpawns[NextPendingSpawnIndex++];
+		if (ASpawnVolume* SpawnVolume = PendingSpawn.Volume.Get())
+		{
+			// Mass 아이템은 액터 없이 엔티티로 스폰하고, 실패하면 액터로 스폰
+			bool bSpawned = MassSubsystem
+				&& UItemMassSubsystem::UsesMassSimulation(PendingSpawn.ItemClass)
+				&& MassSubsystem->SpawnItem(PendingSpawn.ItemClass, PendingSpawn.Location, PendingSpawn.Rotation);
+			if (!bSpawned)
+			{
+				bSpawned = SpawnVolume->SpawnItemAt(PendingSpawn.ItemClass, PendingSpawn.Location, PendingSpawn.Rotation) != nullptr;
+			}
+
+			if (bSpawned)
+			{
+				INC_DWORD_STAT(STAT_Sparta_SpawnsPerWave);
+			}
+			// 만약 스폰된 아이템이 코인 타입이라면 SpawnedCoinCount 증가
+			if (bSpawned && PendingSpawn.ItemClass->IsChildOf(ACoinItem::StaticClass()))
+			{
+				SpawnedCoinCount++;
+			}
+		}
+
+		// 이번 프레임 예산을 다 쓰면 나머지는 다음 프레임에 스폰
+		if (bTimeSlicedSpawning && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			break;
+	}
+
+	if (PendingSpawns.IsValidIndex(NextPendingSpawnIndex))
+	{
+		SpawnSliceTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &ASpartaGameState::SpawnWaveSlice);
+		return;
+	}
+
+	// 아직 바닥 탐색 결과를 기다리는 볼륨이 있으면 도착할 때 다시 호출됨
+	if (NumPendingPointBatches > 0)
+	{
+		PendingSpawns.Reset();
+		NextPendingSpawnIndex = 0;
+		return;
+	}
+
+	CancelPendingSpawns();
+	bWavePopulated = true;
+
+	if (UWaveMetricsSubsystem* MetricsSubsystem = GetWorld()->GetSubsystem<UWaveMetricsSubsystem>())
+	{
+		MetricsSubsystem->MarkWavePopulated();
+	}
+
+	if (USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>())
+	{
+		for (const ASpawnVolume* SpawnVolume : VolumeSubsystem->GetVolumes())
+		{
+			const FItemPoolStats PoolStats = SpawnVolume->GetPoolStats();
+			UE_LOG(LogTemp, Warning, TEXT("[GameState] Item pool (%s) - Created: %d, Reused: %d, Active: %d, Available: %d"),
+				*SpawnVolume->GetName(), PoolStats.NumCreated, PoolStats.NumReused, PoolStats.NumActive, PoolStats.NumAvailable);
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("Level %d - Wave %d populated! Spawned %d coins"),
+		CurrentLevelIndex + 1, CurrentWaveIndex + 1, SpawnedCoinCount);
+
+	OnWavePopulated.Broadcast(CurrentLevelIndex, CurrentWaveIndex);
+
+	// 스폰이 끝나기 전에 이미 모든 코인을 주웠다면 여기서 웨이브 완료 처리
+	if (SpawnedCoinCount > 0 && CollectedCoinCount >= SpawnedCoinCount)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] All coins collected in Wave %d!"), CurrentWaveIndex + 1);
+		CheckWaveCompletion();
+	}
+}
+
+void ASpartaGameState::CancelPendingSpawns()
+{
+	GetWorldTimerManager().ClearTimer(SpawnSliceTimerHandle);
+	PendingSpawns.Reset();
+	NextPendingSpawnIndex = 0;
+	NumPendingPointBatches = 0;
+	// 아직 도착하지 않은 바닥 탐색 결과는 무시되도록 번호 갱신
+	SpawnWaveSerial++;
+}
+
+void ASpartaGameState::OnLevelTimeUp()
+{
+	// 기존 함수 호환성 유지
+	OnWaveTimeUp();
+}
+
+void ASpartaGameState::OnWaveTimeUp()
+{
+	UE_LOG(LogTemp, Warning, TEXT("[GameState] Wave %d time's up!"), CurrentWaveIndex + 1);
+	CheckWaveCompletion();
+}
+
+void ASpartaGameState::OnCoinCollected()
+{
+	if (bWaveLoopSuspended)
+		return;
+
+	CollectedCoinCount++;
+
+	UE_LOG(LogTemp, Warning, TEXT("Coin Collected! Total: %d / %d"),
+		CollectedCoinCount, SpawnedCoinCount);
+
+	// 아직 스폰 중인 웨이브는 스폰이 끝난 뒤에 완료 여부를 판단
+	if (bWavePopulated && SpawnedCoinCount > 0 && CollectedCoinCount >= SpawnedCoinCount)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] All coins collected in Wave %d!"), CurrentWaveIndex + 1);
+		CheckWaveCompletion();
+	}
+}
+
+void ASpartaGameState::RecordPickup()
+{
+	NumRecentPickups++;
+}
+
+void ASpartaGameState::UpdatePickupRate()
+{
+	SET_DWORD_STAT(STAT_Sparta_PickupsPerSecond, NumRecentPickups);
+	NumRecentPickups = 0;
+}
+
+void ASpartaGameState::CheckWaveCompletion()
+{
+	// 모든 코인을 모아서 끝났는지, 시간 초과로 끝났는지 기록
+	if (UWaveMetricsSubsystem* MetricsSubsystem = GetWorld()->GetSubsystem<UWaveMetricsSubsystem>())
+	{
+		const bool bAllCollected = bWavePopulated && SpawnedCoinCount > 0 && CollectedCoinCount >= SpawnedCoinCount;
+		MetricsSubsystem->EndWave(SpawnedCoinCount, CollectedCoinCount, bAllCollected);
+	}
+
+	// 타이머 해제
+	GetWorldTimerManager().ClearTimer(LevelTimerHandle);
+	WaveEndTime = GetWorld()->GetTimeSeconds();
+	// 시간 초과로 끝난 경우 남은 스폰 작업 취소
+	CancelPendingSpawns();
+
+	CurrentWaveIndex++;
+
+	// 현재 레벨의 모든 웨이브를 완료했는지 확인
+	if (CurrentWaveIndex >= MaxWavesPerLevel)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] Level %d completed! All waves finished."), CurrentLevelIndex + 1);
+		
+		// 화면에 레벨 완료 메시지 표시
+		GEngine->AddOnScreenDebugMessage(
+			-1, 
+			3.f, 
+			FColor::Green, 
+			FString::Printf(TEXT("Level %d 완료!"), CurrentLevelIndex + 1), 
+			true, 
+			FVector2D(2.f, 2.f)
+		);
+
+		EndLevel();
+	}
+	else
+	{
+		// 다음 웨이브 시작
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] Wave %d completed! Starting next wave..."), CurrentWaveIndex);
+		
+		// 화면에 웨이브 완료 메시지 표시
+		GEngine->AddOnScreenDebugMessage(
+			-1, 
+			2.f, 
+			FColor::Cyan, 
+			FString::Printf(TEXT("Wave %d 완료! 다음 웨이브 준비..."), CurrentWaveIndex), 
+			true, 
+			FVector2D(2.f, 2.f)
+		);
+
+		// 대기 시간 동안 다음 웨이브의 아이템 선택과 배치를 워커 스레드에서 미리 계산
+		PrepareWaveManifests(CurrentLevelIndex, CurrentWaveIndex);
+
+		// 짧은 딜레이 후 다음 웨이브 시작
+		GetWorldTimerManager().SetTimer(
+			NextWaveTimerHandle,
+			this,
+			&ASpartaGameState::StartWave,
+			2.0f,
+			false);
+	}
+}
+
+void ASpartaGameState::EndLevel()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GameInstance);
+		if (SpartaGameInstance)
+		{
+			// 다음 레벨로 이동
+			CurrentLevelIndex++;
+			SpartaGameInstance->CurrentLevelIndex = CurrentLevelIndex;
+
+			UE_LOG(LogTemp, Warning, TEXT("[GameState] EndLevel - Moving to level index: %d"), CurrentLevelIndex);
+
+			// 모든 레벨을 다 돌았다면 게임 오버
+			if (CurrentLevelIndex >= MaxLevels)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[GameState] All levels completed! Game Over!"));
+				OnGameOver();
+				return;
+			}
+
+			// Mass 아이템은 레벨에 속하지 않아 스트리밍 레벨과 함께 언로드되지 않으므로 직접 정리
+			if (UItemMassSubsystem* MassSubsystem = GetWorld()->GetSubsystem<UItemMassSubsystem>())
+			{
+				MassSubsystem->DestroyAllItems();
+			}
+
+			// 새 레벨의 StartLevel에서 전환 시간을 보고
+			SpartaGameInstance->LevelTransitionStartTime = FPlatformTime::Seconds();
+
+			// 다음 레벨이 스트리밍 서브레벨이면 표시만 전환 (로드가 끝나면 StartLevel 호출)
+			if (TransitionToStreamedLevel(CurrentLevelIndex))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[GameState] Switching to streamed level: %s"), *LevelMapNames[CurrentLevelIndex].ToString());
+			}
+			// 레벨 맵 이름이 있다면 해당 맵 불러오기
+			else if (LevelMapNames.IsValidIndex(CurrentLevelIndex))
+			{
+				FName NextLevelName = LevelMapNames[CurrentLevelIndex];
+
+				// Seamless Travel이면 다음 맵을 백그라운드에서 로드하는 동안 현재 월드를 유지
+				AGameModeBase* GameMode = GetWorld()->GetAuthGameMode();
+				if (GameMode && GameMode->bUseSeamlessTravel)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[GameState] Seamless travel to next level: %s"), *NextLevelName.ToString());
+					GetWorld()->ServerTravel(NextLevelName.ToString());
+				}
+				else
+				{
+					UE_LOG(LogTemp, Warning, TEXT("[GameState] Opening next level: %s"), *NextLevelName.ToString());
+					UGameplayStatics::OpenLevel(GetWorld(), NextLevelName);
+				}
+			}
+			else
+			{
+				SpartaGameInstance->LevelTransitionStartTime = 0.0;
+				UE_LOG(LogTemp, Error, TEXT("[GameState] No level name found for index %d! Going to Game Over."), CurrentLevelIndex);
+				OnGameOver();
+			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("[GameState] Failed to cast to SpartaGameInstance!"));
+		}
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("[GameState] GameInstance is NULL!"));
+	}
+}
+
+bool ASpartaGameState::CanRestartInPlace() const
+{
+	if (!LevelMapNames.IsValidIndex(0))
+		return false;
+
+	// 첫 레벨이 스트리밍 서브레벨이거나, 지금 열려 있는 맵이 첫 레벨이면 그대로 재사용
+	return GetStreamingLevel(0) != nullptr
+		|| UGameplayStatics::GetCurrentLevelName(this) == LevelMapNames[0].ToString();
+}
+
+void ASpartaGameState::RestartInPlace()
+{
+	const double RestartStartTime = FPlatformTime::Seconds();
+
+	StopWaveLoop();
+
+	Score = 0;
+	CurrentLevelIndex = 0;
+	CurrentWaveIndex = 0;
+	bWaveLoopSuspended = false;
+
+	// 첫 레벨이 이미 보이는 상태라면 여기서 시작 위치로 이동 (아니면 레벨이 표시될 때 이동)
+	ULevelStreaming* FirstStreamingLevel = GetStreamingLevel(0);
+	if (!FirstStreamingLevel)
+	{
+		MovePlayerToLevelStart(GetWorld()->PersistentLevel);
+	}
+	else if (FirstStreamingLevel->IsLevelVisible())
+	{
+		MovePlayerToLevelStart(FirstStreamingLevel->GetLoadedLevel());
+	}
+
+	StartLevel();
+
+	UE_LOG(LogTemp, Warning, TEXT("[GameState] Restarted in place in %.2f ms"), (FPlatformTime::Seconds() - RestartStartTime) * 1000.0);
+}
+
+void ASpartaGameState::SetWaveLoopSuspended(bool bSuspended)
+{
+	if (bWaveLoopSuspended == bSuspended)
+		return;
+
+	bWaveLoopSuspended = bSuspended;
+
+	if (bSuspended)
+	{
+		StopWaveLoop();
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] Wave loop suspended"));
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] Wave loop resumed"));
+		StartLevel();
+	}
+}
+
+void ASpartaGameState::StopWaveLoop()
+{
+	// 진행 중이던 웨이브/다음 웨이브 예약 취소
+	GetWorldTimerManager().ClearTimer(LevelTimerHandle);
+	GetWorldTimerManager().ClearTimer(NextWaveTimerHandle);
+	CancelPendingSpawns();
+	PreparedManifests.Reset();
+	PreparedLevelIndex = INDEX_NONE;
+	PreparedWaveIndex = INDEX_NONE;
+
+	// 남아 있는 아이템은 파괴하지 않고 풀로 반환
+	if (USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>())
+	{
+		for (ASpawnVolume* SpawnVolume : VolumeSubsystem->GetVolumes())
+		{
+			if (SpawnVolume)
+			{
+				SpawnVolume->ReleaseAllItems();
+			}
+		}
+	}
+	if (UItemMassSubsystem* MassSubsystem = GetWorld()->GetSubsystem<UItemMassSubsystem>())
+	{
+		MassSubsystem->DestroyAllItems();
+	}
+
+	SpawnedCoinCount = 0;
+	CollectedCoinCount = 0;
+	bWavePopulated = false;
+}
+
+ULevelStreaming* ASpartaGameState::GetStreamingLevel(int32 LevelIndex) const
+{
+	if (!bUseStreamedLevels || !LevelMapNames.IsValidIndex(LevelIndex))
+		return nullptr;
+
+	return UGameplayStatics::GetStreamingLevel(this, LevelMapNames[LevelIndex]);
+}
+
+void ASpartaGameState::PreloadNextLevel()
+{
+	if (ULevelStreaming* NextStreamingLevel = GetStreamingLevel(CurrentLevelIndex + 1))
+	{
+		NextStreamingLevel->SetShouldBeLoaded(true);
+		NextStreamingLevel->SetShouldBeVisible(false);
+	}
+}
+
+bool ASpartaGameState::TransitionToStreamedLevel(int32 LevelIndex)
+{
+	ULevelStreaming* NextStreamingLevel = GetStreamingLevel(LevelIndex);
+	if (!NextStreamingLevel)
+		return false;
+
+	// 나머지 레벨은 숨기고 언로드 (그 레벨의 SpawnVolume과 아이템도 함께 내려감)
+	for (int32 i = 0; i < LevelMapNames.Num(); i++)
+	{
+		ULevelStreaming* OtherStreamingLevel = GetStreamingLevel(i);
+		if (i != LevelIndex && OtherStreamingLevel)
+		{
+			OtherStreamingLevel->SetShouldBeVisible(false);
+			OtherStreamingLevel->SetShouldBeLoaded(false);
+		}
+	}
+
+	PendingShownLevel = NextStreamingLevel;
+	if (NextStreamingLevel->IsLevelVisible())
+	{
+		OnStreamedLevelShown();
+		return true;
+	}
+
+	NextStreamingLevel->OnLevelShown.AddUniqueDynamic(this, &ASpartaGameState::OnStreamedLevelShown);
+	NextStreamingLevel->SetShouldBeLoaded(true);
+	NextStreamingLevel->SetShouldBeVisible(true);
+	return true;
+}
+
+void ASpartaGameState::OnStreamedLevelShown()
+{
+	ULevelStreaming* ShownStreamingLevel = PendingShownLevel.Get();
+	PendingShownLevel.Reset();
+
+	if (ShownStreamingLevel)
+	{
+		ShownStreamingLevel->OnLevelShown.RemoveDynamic(this, &ASpartaGameState::OnStreamedLevelShown);
+		MovePlayerToLevelStart(ShownStreamingLevel->GetLoadedLevel());
+	}
+
+	StartLevel();
+}
+
+void ASpartaGameState::ReportLevelTransition()
+{
+	USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GetGameInstance());
+	if (!SpartaGameInstance || SpartaGameInstance->LevelTransitionStartTime <= 0.0)
+		return;
+
+	const double TransitionMs = (FPlatformTime::Seconds() - SpartaGameInstance->LevelTransitionStartTime) * 1000.0;
+	SpartaGameInstance->LevelTransitionStartTime = 0.0;
+
+	UE_LOG(LogTemp, Warning, TEXT("[GameState] Level %d transition took %.1f ms"), CurrentLevelIndex + 1, TransitionMs);
+}
+
+void ASpartaGameState::MovePlayerToLevelStart(ULevel* Level)
+{
+	APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0);
+	if (!Level || !PlayerPawn)
+		return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (APlayerStart* PlayerStart = Cast<APlayerStart>(Actor))
+		{
+			PlayerPawn->TeleportTo(PlayerStart->GetActorLocation(), PlayerStart->GetActorRotation());
+			if (AController* Controller = PlayerPawn->GetController())
+			{
+				Controller->SetControlRotation(PlayerStart->GetActorRotation());
+			}
+			break;
+		}
+	}
+
+	// 맵을 새로 열 때처럼 체력을 가득 채운 상태로 시작
+	if (ASpartaCharacter* SpartaCharacter = Cast<ASpartaCharacter>(PlayerPawn))
+	{
+		SpartaCharacter->ResetHealth();
+	}
+}
+
+void ASpartaGameState::OnGameOver()
+{
+	UE_LOG(LogTemp, Warning, TEXT("[GameState] Game Over called"));
+	
+	// 화면에 게임 오버 메시지 표시
+	GEngine->AddOnScreenDebugMessage(
+		-1, 
+		5.f, 
+		FColor::Red, 
+		TEXT("모든 레벨 완료! Game Over!"), 
+		true, 
+		FVector2D(2.5f, 2.5f)
+	);
+
+	if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+	{
+		if (ASpartaPlayerController* SpartaPlayerController = Cast<ASpartaPlayerController>(PlayerController))
+		{
+			SpartaPlayerController->SetPause(true);
+			SpartaPlayerController->ShowMainMenu(true);
+		}
+	}
+}
+
+ASpartaPlayerController* ASpartaGameState::GetHUDController()
+{
+	if (!CachedHUDController.IsValid())
+	{
+		if (APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+		{
+			CachedHUDController = Cast<ASpartaPlayerController>(PlayerController);
+		}
+	}
+	return CachedHUDController.Get();
+}
+
+void ASpartaGameState::UpdateHUD()
+{
+	// 새 HUD에는 시간이 표시되지 않은 상태이므로 강제로 다시 그림
+	DisplayedTimeTenths = INDEX_NONE;
+
+	UpdateTimeHUD();
+	UpdateScoreHUD();
+	UpdateLevelHUD();
+}
+
+void ASpartaGameState::UpdateTimeHUD()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_UpdateHUD);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpartaGameState::UpdateTimeHUD);
+
+	const float RemainingTime = FMath::Max(WaveEndTime - GetWorld()->GetTimeSeconds(), 0.f);
+	const int32 RemainingTenths = FMath::CeilToInt32(RemainingTime * 10.f);
+
+	// 표시되는 값이 바뀌지 않았다면 아무 작업도 하지 않음
+	if (RemainingTenths == DisplayedTimeTenths)
+		return;
+
+	if (ASpartaPlayerController* SpartaPlayerController = GetHUDController())
+	{
+		DisplayedTimeTenths = RemainingTenths;
+		SpartaPlayerController->SetHUDTimeText(FText::FromString(FString::Printf(TEXT("Time: %.1f"), RemainingTenths * 0.1f)));
+	}
+}
+
+void ASpartaGameState::UpdateScoreHUD()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_UpdateHUD);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpartaGameState::UpdateScoreHUD);
+
+	if (ASpartaPlayerController* SpartaPlayerController = GetHUDController())
+	{
+		if (USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GetGameInstance()))
+		{
+			SpartaPlayerController->SetHUDScoreText(FText::FromString(FString::Printf(TEXT("Score: %d"), SpartaGameInstance->TotalScore)));
+		}
+	}
+}
+
+void ASpartaGameState::UpdateLevelHUD()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_UpdateHUD);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpartaGameState::UpdateLevelHUD);
+
+	if (ASpartaPlayerController* SpartaPlayerController = GetHUDController())
+	{
+		SpartaPlayerController->SetHUDLevelText(FText::FromString(FString::Printf(TEXT("Level %d - Wave %d"),
+			CurrentLevelIndex + 1, CurrentWaveIndex + 1)));
+	}
+}
@@ -1,155 +1,202 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SpartaPlayerController.h"
-#include "SpartaGameState.h"
-#include "SpartaGameInstance.h"
-#include "EnhancedInputSubsystems.h"
-#include "Blueprint/UserWidget.h"
-#include "Kismet/GameplayStatics.h"
-#include "Components/TextBlock.h"
-
-ASpartaPlayerController::ASpartaPlayerController()
-	: InputMappingContext(nullptr)
-	, MoveAction(nullptr)
-	, JumpAction(nullptr)
-	, SprintAction(nullptr)
-	, LookAction(nullptr)
-	, HUDWidgetClass(nullptr)
-	, HUDWidgetInstance(nullptr)
-	, MainMenuWidgetClass(nullptr)
-	, MainMenuWidgetInstance(nullptr)
-{
-}
-
-void ASpartaPlayerController::BeginPlay()
-{
-	Super::BeginPlay();
-
-	// 현재 PlayerController에 연결된 LocalPlayer 객체를 가져옴
-	if (ULocalPlayer* LocalPlayer = GetLocalPlayer())
-	{
-		// Local Player에서 EnhancedInputLocalPlayerSubsystem를 획득
-		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
-		{
-			if (InputMappingContext)
-			{
-				// Subsystem을 통해 할당한 IMC를 활성화
-				// 우선순위는 0이 가장 높은 우선순위
-				Subsystem->AddMappingContext(InputMappingContext, 0);
-			}
-		}
-	}
-
-	// 게임 실행 시 메뉴 레벨에서 메뉴 UI 먼저 표시
-	FString CurrentMapName = GetWorld()->GetMapName();
-	if (CurrentMapName.Contains("MenuLevel"))
-	{
-		ShowMainMenu(false);
-	}
-}
-
-UUserWidget* ASpartaPlayerController::GetHUDWidget() const
-{
-	return HUDWidgetInstance;
-}
-
-// 메뉴 UI 표시
-void ASpartaPlayerController::ShowMainMenu(bool bIsRestart)
-{
-	// HUD가 켜져 있다면 닫기
-	if (HUDWidgetInstance)
-	{
-		HUDWidgetInstance->RemoveFromParent();
-		HUDWidgetInstance = nullptr;
-	}
-
-	// 이미 메뉴가 떠 있으면 제거
-	if (MainMenuWidgetInstance)
-	{
-		MainMenuWidgetInstance->RemoveFromParent();
-		MainMenuWidgetInstance = nullptr;
-	}
-
-	// 메뉴 UI 생성
-	if (MainMenuWidgetClass)
-	{
-		MainMenuWidgetInstance = CreateWidget<UUserWidget>(this, MainMenuWidgetClass);
-		if (MainMenuWidgetInstance)
-		{
-			MainMenuWidgetInstance->AddToViewport();
-
-			bShowMouseCursor = true;
-			SetInputMode(FInputModeUIOnly());
-		}
-
-		if (UTextBlock* ButtonText = Cast<UTextBlock>(MainMenuWidgetInstance->GetWidgetFromName(TEXT("StartButtonText"))))
-		{
-			if (bIsRestart)
-			{
-				UFunction* PlayAnimFunc = MainMenuWidgetInstance->FindFunction(FName("PlayGameOverAnim"));
-				if (PlayAnimFunc)
-				{
-					MainMenuWidgetInstance->ProcessEvent(PlayAnimFunc, nullptr);
-				}
-
-				if (UTextBlock* TotalScoreText = Cast<UTextBlock>(MainMenuWidgetInstance->GetWidgetFromName("TotalScoreText")))
-				{
-					if (USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(UGameplayStatics::GetGameInstance(this)))
-					{
-						TotalScoreText->SetText(FText::FromString(
-							FString::Printf(TEXT("Total Score: %d"), SpartaGameInstance->TotalScore)));
-					}
-				}
-			}
-		}
-	}
-}
-
-// 게임 HUD 표시
-void ASpartaPlayerController::ShowGameHUD()
-{
-	// HUD가 켜져 있다면 닫기
-	if (HUDWidgetInstance)
-	{
-		HUDWidgetInstance->RemoveFromParent();
-		HUDWidgetInstance = nullptr;
-	}
-
-	// 이미 메뉴가 떠 있으면 제거
-	if (MainMenuWidgetInstance)
-	{
-		MainMenuWidgetInstance->RemoveFromParent();
-		MainMenuWidgetInstance = nullptr;
-	}
-
-	if (HUDWidgetClass)
-	{
-		HUDWidgetInstance = CreateWidget<UUserWidget>(this, HUDWidgetClass);
-		if (HUDWidgetInstance)
-		{
-			HUDWidgetInstance->AddToViewport();
-
-			bShowMouseCursor = false;
-			SetInputMode(FInputModeGameOnly());
-
-			ASpartaGameState* SpartaGameState = GetWorld() ? GetWorld()->GetGameState<ASpartaGameState>() : nullptr;
-			if (SpartaGameState)
-			{
-				SpartaGameState->UpdateHUD();
-			}
-		}
-	}
-}
-
-// 게임 시작 - BasicLevel 오픈, GameInstance 데이터 리셋
-void ASpartaPlayerController::StartGame()
-{
-	if (USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(UGameplayStatics::GetGameInstance(this)))
-	{
-		SpartaGameInstance->CurrentLevelIndex = 0;
-		SpartaGameInstance->TotalScore = 0;
-	}
-
-	UGameplayStatics::OpenLevel(GetWorld(), FName("BasicLevel"));
-	SetPause(false);
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaPlayerController.h"
+#include "SpartaGameState.h"
+#include "SpartaGameInstance.h"
+#include "EnhancedInputSubsystems.h"
+#include "Blueprint/UserWidget.h"
+#include "Kismet/GameplayStatics.h"
+#include "Components/TextBlock.h"
+
+ASpartaPlayerController::ASpartaPlayerController()
+	: InputMappingContext(nullptr)
+	, MoveAction(nullptr)
+	, JumpAction(nullptr)
+	, SprintAction(nullptr)
+	, LookAction(nullptr)
+	, HUDWidgetClass(nullptr)
+	, HUDWidgetInstance(nullptr)
+	, MainMenuWidgetClass(nullptr)
+	, MainMenuWidgetInstance(nullptr)
+	, HUDTimeText(nullptr)
+	, HUDScoreText(nullptr)
+	, HUDLevelText(nullptr)
+{
+}
+
+void ASpartaPlayerController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// 현재 PlayerController에 연결된 LocalPlayer 객체를 가져옴
+	if (ULocalPlayer* LocalPlayer = GetLocalPlayer())
+	{
+		// Local Player에서 EnhancedInputLocalPlayerSubsystem를 획득
+		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = LocalPlayer->GetSubsystem<UEnhancedInputLocalPlayerSubsystem>())
+		{
+			if (InputMappingContext)
+			{
+				// Subsystem을 통해 할당한 IMC를 활성화
+				// 우선순위는 0이 가장 높은 우선순위
+				Subsystem->AddMappingContext(InputMappingContext, 0);
+			}
+		}
+	}
+
+	// 게임 실행 시 메뉴 레벨에서 메뉴 UI 먼저 표시
+	FString CurrentMapName = GetWorld()->GetMapName();
+	if (CurrentMapName.Contains("MenuLevel"))
+	{
+		ShowMainMenu(false);
+	}
+}
+
+UUserWidget* ASpartaPlayerController::GetHUDWidget() const
+{
+	return HUDWidgetInstance;
+}
+
+void ASpartaPlayerController::SetHUDTimeText(const FText& Text)
+{
+	if (HUDTimeText)
+	{
+		HUDTimeText->SetText(Text);
+	}
+}
+
+void ASpartaPlayerController::SetHUDScoreText(const FText& Text)
+{
+	if (HUDScoreText)
+	{
+		HUDScoreText->SetText(Text);
+	}
+}
+
+void ASpartaPlayerController::SetHUDLevelText(const FText& Text)
+{
+	if (HUDLevelText)
+	{
+		HUDLevelText->SetText(Text);
+	}
+}
+
+// 메뉴 UI 표시
+void ASpartaPlayerController::ShowMainMenu(bool bIsRestart)
+{
+	// HUD가 켜져 있다면 닫기
+	if (HUDWidgetInstance)
+	{
+		HUDWidgetInstance->RemoveFromParent();
+		HUDWidgetInstance = nullptr;
+	}
+	HUDTimeText = nullptr;
+	HUDScoreText = nullptr;
+	HUDLevelText = nullptr;
+
+	// 이미 메뉴가 떠 있으면 제거
+	if (MainMenuWidgetInstance)
+	{
+		MainMenuWidgetInstance->RemoveFromParent();
+		MainMenuWidgetInstance = nullptr;
+	}
+
+	// 메뉴 UI 생성
+	if (MainMenuWidgetClass)
+	{
+		MainMenuWidgetInstance = CreateWidget<UUserWidget>(this, MainMenuWidgetClass);
+		if (MainMenuWidgetInstance)
+		{
+			MainMenuWidgetInstance->AddToViewport();
+
+			bShowMouseCursor = true;
+			SetInputMode(FInputModeUIOnly());
+		}
+
+		if (UTextBlock* ButtonText = Cast<UTextBlock>(MainMenuWidgetInstance->GetWidgetFromName(TEXT("StartButtonText"))))
+		{
+			if (bIsRestart)
+			{
+				UFunction* PlayAnimFunc = MainMenuWidgetInstance->FindFunction(FName("PlayGameOverAnim"));
+				if (PlayAnimFunc)
+				{
+					MainMenuWidgetInstance->ProcessEvent(PlayAnimFunc, nullptr);
+				}
+
+				if (UTextBlock* TotalScoreText = Cast<UTextBlock>(MainMenuWidgetInstance->GetWidgetFromName("TotalScoreText")))
+				{
+					if (USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(UGameplayStatics::GetGameInstance(this)))
+					{
+						TotalScoreText->SetText(FText::FromString(
+							FString::Printf(TEXT("Total Score: %d"), SpartaGameInstance->TotalScore)));
+					}
+				}
+			}
+		}
+	}
+}
+
+// 게임 HUD 표시
+void ASpartaPlayerController::ShowGameHUD()
+{
+	// HUD가 켜져 있다면 닫기
+	if (HUDWidgetInstance)
+	{
+		HUDWidgetInstance->RemoveFromParent();
+		HUDWidgetInstance = nullptr;
+	}
+	HUDTimeText = nullptr;
+	HUDScoreText = nullptr;
+	HUDLevelText = nullptr;
+
+	// 이미 메뉴가 떠 있으면 제거
+	if (MainMenuWidgetInstance)
+	{
+		MainMenuWidgetInstance->RemoveFromParent();
+		MainMenuWidgetInstance = nullptr;
+	}
+
+	if (HUDWidgetClass)
+	{
+		HUDWidgetInstance = CreateWidget<UUserWidget>(this, HUDWidgetClass);
+		if (HUDWidgetInstance)
+		{
+			HUDWidgetInstance->AddToViewport();
+
+			// 갱신할 때마다 이름으로 찾지 않도록 한 번만 찾아둠
+			HUDTimeText = Cast<UTextBlock>(HUDWidgetInstance->GetWidgetFromName(TEXT("Time")));
+			HUDScoreText = Cast<UTextBlock>(HUDWidgetInstance->GetWidgetFromName(TEXT("Score")));
+			HUDLevelText = Cast<UTextBlock>(HUDWidgetInstance->GetWidgetFromName(TEXT("Level")));
+
+			bShowMouseCursor = false;
+			SetInputMode(FInputModeGameOnly());
+
+			ASpartaGameState* SpartaGameState = GetWorld() ? GetWorld()->GetGameState<ASpartaGameState>() : nullptr;
+			if (SpartaGameState)
+			{
+				SpartaGameState->UpdateHUD();
+			}
+		}
+	}
+}
+
+// 게임 시작 - BasicLevel 오픈, GameInstance 데이터 리셋
+void ASpartaPlayerController::StartGame()
+{
+	if (USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(UGameplayStatics::GetGameInstance(this)))
+	{
+		SpartaGameInstance->CurrentLevelIndex = 0;
+		SpartaGameInstance->TotalScore = 0;
+	}
+
+	SetPause(false);
+
+	// 이미 게임 맵에 있다면 맵을 다시 열지 않고 같은 월드에서 재시작
+	ASpartaGameState* SpartaGameState = GetWorld() ? GetWorld()->GetGameState<ASpartaGameState>() : nullptr;
+	if (SpartaGameState && SpartaGameState->CanRestartInPlace())
+	{
+		SpartaGameState->RestartInPlace();
+		return;
+	}
+
+	UGameplayStatics::OpenLevel(GetWorld(), FName("BasicLevel"));
 }
\ No newline at end of file
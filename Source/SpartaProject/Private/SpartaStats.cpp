@@ -0,0 +1,23 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaStats.h"
+
+DEFINE_STAT(STAT_Sparta_StartWave);
+DEFINE_STAT(STAT_Sparta_SpawnWaveSlice);
+DEFINE_STAT(STAT_Sparta_SpawnRandomItem);
+DEFINE_STAT(STAT_Sparta_GetRandomItem);
+DEFINE_STAT(STAT_Sparta_GetRandomPointInVolume);
+DEFINE_STAT(STAT_Sparta_BuildWaveManifest);
+DEFINE_STAT(STAT_Sparta_ItemTick);
+DEFINE_STAT(STAT_Sparta_ActivateItem);
+DEFINE_STAT(STAT_Sparta_Explode);
+DEFINE_STAT(STAT_Sparta_MassItemTick);
+DEFINE_STAT(STAT_Sparta_UpdateHUD);
+
+DEFINE_STAT(STAT_Sparta_LiveItems);
+DEFINE_STAT(STAT_Sparta_MassItems);
+DEFINE_STAT(STAT_Sparta_MidSignificanceItems);
+DEFINE_STAT(STAT_Sparta_FarSignificanceItems);
+DEFINE_STAT(STAT_Sparta_SpawnsPerWave);
+DEFINE_STAT(STAT_Sparta_PickupsPerSecond);
+DEFINE_STAT(STAT_Sparta_ItemOverlapEvents);
@@ -1,136 +1,808 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#include "SpawnVolume.h"
-#include "Components/BoxComponent.h"
-#include "Engine/World.h"
-#include "GameFramework/Actor.h"
-
-ASpawnVolume::ASpawnVolume()
-{
-	PrimaryActorTick.bCanEverTick = false;
-
-	// 박스 컴포넌트를 생성하고, 이 액터의 루트로 설정
-	Scene = CreateDefaultSubobject<USceneComponent>(TEXT("Scene"));
-	SetRootComponent(Scene);
-
-	SpawningBox = CreateDefaultSubobject<UBoxComponent>(TEXT("SpawningBox"));
-	SpawningBox->SetupAttachment(Scene);
-
-	CurrentItemDataTable = nullptr;
-}
-
-void ASpawnVolume::SetCurrentDataTableIndex(int32 LevelIndex, int32 WaveIndex)
-{
-	// 인덱스 계산: (레벨 인덱스 * 3) + 웨이브 인덱스
-	int32 TableIndex = (LevelIndex * 3) + WaveIndex;
-
-	if (ItemDataTables.IsValidIndex(TableIndex))
-	{
-		CurrentItemDataTable = ItemDataTables[TableIndex];
-		UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] DataTable changed to index %d (Level %d, Wave %d)"), 
-			TableIndex, LevelIndex + 1, WaveIndex + 1);
-	}
-	else
-	{
-		UE_LOG(LogTemp, Error, TEXT("[SpawnVolume] Invalid DataTable index: %d"), TableIndex);
-	}
-}
-
-AActor* ASpawnVolume::SpawnRandomItem()
-{
-	if (FItemSpawnRow* SelectedRow = GetRandomItem())
-	{
-		if (UClass* ActualClass = SelectedRow->ItemClass.Get())
-		{
-			return SpawnItem(ActualClass);
-		}
-	}
-	return nullptr;
-}
-
-FVector ASpawnVolume::GetRandomPointInVolume() const
-{
-	// 박스 컴포넌트의 스케일된 Extent, 즉 x/y/z 방향으로 반지름을 구함
-	FVector BoxExtent = SpawningBox->GetScaledBoxExtent();
-	// 박스 중심 위치
-	FVector BoxOrigin = SpawningBox->GetComponentLocation();
-
-	// 각 축별로 -Extent ~ +Extent 범위 내에서 무작위 좌표를 생성
-	FVector RandomPoint = BoxOrigin + FVector(
-		FMath::FRandRange(-BoxExtent.X, BoxExtent.X),
-		FMath::FRandRange(-BoxExtent.Y, BoxExtent.Y),
-		FMath::FRandRange(-BoxExtent.Z, BoxExtent.Z)
-	);
-
-	// 바닥 감지를 위한 LineTrace
-	FHitResult HitResult;
-	FVector TraceStart = RandomPoint + FVector(0.f, 0.f, 500.f);
-	FVector TraceEnd = RandomPoint - FVector(0.f, 0.f, 1000.f);
-
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
-	// 바닥 찾기
-	if (GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_Visibility, QueryParams))
-	{
-		// 바닥 위 50 유닛 높이에 스폰
-		return HitResult.Location + FVector(0.f, 0.f, 50.f);
-	}
-
-	// 바닥을 찾지 못한 경우 원래 위치 반환
-	return RandomPoint;
-}
-
-FItemSpawnRow* ASpawnVolume::GetRandomItem() const
-{
-	// 현재 설정된 DataTable 사용
-	if (!CurrentItemDataTable)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[SpawnVolume] CurrentItemDataTable is NULL!"));
-		return nullptr;
-	}
-
-	// 모든 Row 가져오기
-	TArray<FItemSpawnRow*> AllRows;
-	static const FString ContextString(TEXT("ItemSpawnContext"));
-	CurrentItemDataTable->GetAllRows(ContextString, AllRows);
-
-	if (AllRows.IsEmpty())
-		return nullptr;
-
-	// 전체 확률 합 구하기
-	float TotalChance = 0.f;
-	for (const FItemSpawnRow* Row : AllRows)
-	{
-		if (Row)
-		{
-			TotalChance += Row->SpawnChance;
-		}
-	}
-
-	const float RandValue = FMath::FRandRange(0.f, TotalChance);
-	float AccumulateChance = 0.f;
-
-	for (FItemSpawnRow* Row : AllRows)
-	{
-		AccumulateChance += Row->SpawnChance;
-		if (RandValue <= AccumulateChance)
-		{
-			return Row;
-		}
-	}
-	return nullptr;
-}
-
-AActor* ASpawnVolume::SpawnItem(TSubclassOf<AActor> ItemClass)
-{
-	if (!ItemClass)
-		return nullptr;
-
-	AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(
-		ItemClass,
-		GetRandomPointInVolume(),
-		FRotator::ZeroRotator);
-
-	return SpawnedActor;
-}
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpawnVolume.h"
+#include "BaseItem.h"
+#include "SpawnVolumeSubsystem.h"
+#include "SpartaGameInstance.h"
+#include "SpartaStats.h"
+#include "PoissonDiscSampler.h"
+#include "Components/BoxComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "Async/Async.h"
+#include "GameFramework/Actor.h"
+#include "TimerManager.h"
+
+namespace
+{
+	// 바닥 탐색 LineTrace 시작 높이 / 탐색 깊이
+	constexpr float FloorTraceUp = 500.f;
+	constexpr float FloorTraceDown = 1000.f;
+	// 바닥 위로 띄워서 스폰할 높이
+	constexpr float SpawnHeightAboveFloor = 50.f;
+}
+
+ASpawnVolume::ASpawnVolume()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	// 박스 컴포넌트를 생성하고, 이 액터의 루트로 설정
+	Scene = CreateDefaultSubobject<USceneComponent>(TEXT("Scene"));
+	SetRootComponent(Scene);
+
+	SpawningBox = CreateDefaultSubobject<UBoxComponent>(TEXT("SpawningBox"));
+	SpawningBox->SetupAttachment(Scene);
+
+	CurrentItemDataTable = nullptr;
+	CurrentDataTableIndex = INDEX_NONE;
+	SpawnWeight = 0.f;
+	PoolPrewarmItemCount = 60;
+	PlacementMode = ESpawnPlacementMode::Uniform;
+	MinItemSeparation = 120.f;
+	NumPointsToBake = 512;
+	bUseBakedSpawnPoints = false;
+	NextSpawnPointBatchId = 0;
+}
+
+void ASpawnVolume::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>())
+	{
+		VolumeSubsystem->RegisterVolume(this);
+	}
+
+	// 첫 웨이브 테이블과 아이템 클래스를 비동기로 로드 (로드가 끝나면 풀도 채움)
+	int32 LevelIndex = 0;
+	if (const USpartaGameInstance* SpartaGameInstance = GetGameInstance<USpartaGameInstance>())
+	{
+		LevelIndex = SpartaGameInstance->CurrentLevelIndex;
+	}
+	PreloadDataTable(LevelIndex, 0);
+}
+
+void ASpawnVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USpawnVolumeSubsystem* VolumeSubsystem = GetWorld()->GetSubsystem<USpawnVolumeSubsystem>())
+	{
+		VolumeSubsystem->UnregisterVolume(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+float ASpawnVolume::GetSpawnWeight() const
+{
+	if (SpawnWeight > 0.f)
+		return SpawnWeight;
+
+	// 가중치를 지정하지 않았다면 박스 부피에 비례
+	const FVector BoxExtent = SpawningBox->GetScaledBoxExtent();
+	return 8.f * BoxExtent.X * BoxExtent.Y * BoxExtent.Z;
+}
+
+void ASpawnVolume::SetSpawnSeed(int32 Seed)
+{
+	SpawnStream.Initialize(Seed);
+}
+
+void ASpawnVolume::SetCurrentDataTableIndex(int32 LevelIndex, int32 WaveIndex)
+{
+	// 인덱스 계산: (레벨 인덱스 * 3) + 웨이브 인덱스
+	int32 TableIndex = GetDataTableIndex(LevelIndex, WaveIndex);
+
+	if (ItemDataTables.IsValidIndex(TableIndex))
+	{
+		CurrentDataTableIndex = TableIndex;
+
+		FDataTablePreload& Preload = DataTablePreloads.FindOrAdd(TableIndex);
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+
+		// 미리 로드가 아직 진행 중이면 새로 요청하지 않고 그 요청이 끝나기를 기다림
+		if (Preload.TableHandle.IsValid() && Preload.TableHandle->IsLoadingInProgress())
+		{
+			Preload.TableHandle->WaitUntilComplete();
+		}
+		if (Preload.ClassHandle.IsValid() && Preload.ClassHandle->IsLoadingInProgress())
+		{
+			Preload.ClassHandle->WaitUntilComplete();
+		}
+
+		// 미리 로드를 요청하지 않았다면 여기서 동기 로드
+		CurrentItemDataTable = ItemDataTables[TableIndex].Get();
+		if (!CurrentItemDataTable || !Preload.TableHandle.IsValid())
+		{
+			UE_LOG(LogTemp, Log, TEXT("[SpawnVolume] DataTable index %d was not preloaded, loading synchronously"), TableIndex);
+
+			Preload.TableHandle = StreamableManager.RequestSyncLoad(ItemDataTables[TableIndex].ToSoftObjectPath());
+			CurrentItemDataTable = ItemDataTables[TableIndex].Get();
+		}
+
+		// 테이블 로드 콜백보다 먼저 불려 아이템 클래스 요청이 아직 없으면 함께 동기 로드
+		if (!Preload.ClassHandle.IsValid())
+		{
+			TArray<FSoftObjectPath> ClassPaths;
+			GetItemClassPaths(CurrentItemDataTable, ClassPaths);
+			if (ClassPaths.Num() > 0)
+			{
+				Preload.ClassHandle = StreamableManager.RequestSyncLoad(ClassPaths);
+			}
+		}
+
+		// 테이블이 바뀐 경우에만 샘플러 재생성
+		if (ItemSampler.GetSourceTable() != CurrentItemDataTable)
+		{
+			ItemSampler.Build(CurrentItemDataTable);
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] DataTable changed to index %d (Level %d, Wave %d)"), 
+			TableIndex, LevelIndex + 1, WaveIndex + 1);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SpawnVolume] Invalid DataTable index: %d"), TableIndex);
+	}
+}
+
+void ASpawnVolume::PreloadDataTable(int32 LevelIndex, int32 WaveIndex)
+{
+	const int32 TableIndex = GetDataTableIndex(LevelIndex, WaveIndex);
+
+	// 현재 테이블과 새로 요청한 테이블 외에는 더 이상 메모리에 붙잡아 둘 필요 없음
+	TArray<int32> StaleIndices;
+	for (const TPair<int32, FDataTablePreload>& Pair : DataTablePreloads)
+	{
+		if (Pair.Key != TableIndex && Pair.Key != CurrentDataTableIndex)
+		{
+			StaleIndices.Add(Pair.Key);
+		}
+	}
+	for (int32 StaleIndex : StaleIndices)
+	{
+		ReleasePreload(StaleIndex);
+	}
+
+	if (!ItemDataTables.IsValidIndex(TableIndex) || ItemDataTables[TableIndex].IsNull() || DataTablePreloads.Contains(TableIndex))
+		return;
+
+	FDataTablePreload& Preload = DataTablePreloads.Add(TableIndex);
+	Preload.TableHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ItemDataTables[TableIndex].ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &ASpawnVolume::OnDataTablePreloaded, TableIndex));
+}
+
+void ASpawnVolume::OnDataTablePreloaded(int32 TableIndex)
+{
+	// SetCurrentDataTableIndex에서 기다리면서 아이템 클래스까지 이미 로드했다면 다시 요청하지 않음
+	FDataTablePreload* Preload = DataTablePreloads.Find(TableIndex);
+	if (!Preload || Preload->ClassHandle.IsValid())
+		return;
+
+	TArray<FSoftObjectPath> ClassPaths;
+	GetItemClassPaths(ItemDataTables[TableIndex].Get(), ClassPaths);
+	if (ClassPaths.Num() == 0)
+		return;
+
+	Preload->ClassHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		ClassPaths,
+		FStreamableDelegate::CreateUObject(this, &ASpawnVolume::OnItemClassesPreloaded, TableIndex));
+}
+
+void ASpawnVolume::OnItemClassesPreloaded(int32 TableIndex)
+{
+	if (!DataTablePreloads.Contains(TableIndex))
+		return;
+
+	// 아이템 클래스가 준비되었으니 웨이브가 시작되기 전에 풀도 채워둠
+	PrewarmPoolForTable(ItemDataTables[TableIndex].Get());
+}
+
+void ASpawnVolume::ReleasePreload(int32 TableIndex)
+{
+	FDataTablePreload Preload;
+	if (!DataTablePreloads.RemoveAndCopyValue(TableIndex, Preload))
+		return;
+
+	if (Preload.TableHandle.IsValid())
+	{
+		Preload.TableHandle->ReleaseHandle();
+	}
+	if (Preload.ClassHandle.IsValid())
+	{
+		Preload.ClassHandle->ReleaseHandle();
+	}
+}
+
+void ASpawnVolume::GetItemClassPaths(const UDataTable* DataTable, TArray<FSoftObjectPath>& OutPaths)
+{
+	OutPaths.Reset();
+	if (!DataTable)
+		return;
+
+	DataTable->ForeachRow<FItemSpawnRow>(TEXT("ItemClassPreload"), [&OutPaths](const FName& Key, const FItemSpawnRow& Row)
+	{
+		if (!Row.ItemClass.IsNull())
+		{
+			OutPaths.AddUnique(Row.ItemClass.ToSoftObjectPath());
+		}
+	});
+}
+
+UClass* ASpawnVolume::ResolveItemClass(const FItemSpawnRow& Row)
+{
+	UClass* ItemClass = Row.ItemClass.Get();
+	if (!ItemClass && !Row.ItemClass.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] Item class %s was not preloaded, loading synchronously"), *Row.ItemClass.ToString());
+		ItemClass = Row.ItemClass.LoadSynchronous();
+	}
+	return ItemClass;
+}
+
+AActor* ASpawnVolume::SpawnRandomItem()
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_SpawnRandomItem);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::SpawnRandomItem);
+
+	if (FItemSpawnRow* SelectedRow = GetRandomItem())
+	{
+		if (UClass* ActualClass = ResolveItemClass(*SelectedRow))
+		{
+			return SpawnItem(ActualClass);
+		}
+	}
+	return nullptr;
+}
+
+FVector ASpawnVolume::GetRandomPointInBox() const
+{
+	// 박스 컴포넌트의 스케일된 Extent, 즉 x/y/z 방향으로 반지름을 구함
+	FVector BoxExtent = SpawningBox->GetScaledBoxExtent();
+	// 박스 중심 위치
+	FVector BoxOrigin = SpawningBox->GetComponentLocation();
+
+	// 각 축별로 -Extent ~ +Extent 범위 내에서 무작위 좌표를 생성
+	return BoxOrigin + FVector(
+		SpawnStream.FRandRange(-BoxExtent.X, BoxExtent.X),
+		SpawnStream.FRandRange(-BoxExtent.Y, BoxExtent.Y),
+		SpawnStream.FRandRange(-BoxExtent.Z, BoxExtent.Z)
+	);
+}
+
+void ASpawnVolume::GetFloorTraceSegment(const FVector& Point, FVector& OutStart, FVector& OutEnd) const
+{
+	OutStart = Point + FVector(0.f, 0.f, FloorTraceUp);
+	OutEnd = Point - FVector(0.f, 0.f, FloorTraceDown);
+}
+
+FVector ASpawnVolume::GetRandomPointInVolume() const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_GetRandomPointInVolume);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::GetRandomPointInVolume);
+
+	// 구워둔 위치가 있으면 물리 쿼리 없이 선택
+	if (HasBakedSpawnPoints())
+	{
+		const FVector3f& BakedPoint = BakedSpawnPoints[SpawnStream.RandRange(0, BakedSpawnPoints.Num() - 1)];
+		return GetActorTransform().TransformPosition(FVector(BakedPoint));
+	}
+
+	FVector RandomPoint = GetRandomPointInBox();
+
+	// 바닥 감지를 위한 LineTrace
+	FHitResult HitResult;
+	FVector TraceStart;
+	FVector TraceEnd;
+	GetFloorTraceSegment(RandomPoint, TraceStart, TraceEnd);
+
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(this);
+
+	// 바닥 찾기
+	if (GetWorld()->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_Visibility, QueryParams))
+	{
+		// 바닥 위 50 유닛 높이에 스폰
+		return HitResult.Location + FVector(0.f, 0.f, SpawnHeightAboveFloor);
+	}
+
+	// 바닥을 찾지 못한 경우 원래 위치 반환
+	return RandomPoint;
+}
+
+TFuture<FWaveManifest> ASpawnVolume::BuildWaveManifestAsync(int32 LevelIndex, int32 WaveIndex, int32 Count, int32 Seed)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_BuildWaveManifest);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::BuildWaveManifestAsync);
+
+	// 테이블 로드와 클래스 확인은 UObject를 건드리므로 게임 스레드에서 처리
+	SetCurrentDataTableIndex(LevelIndex, WaveIndex);
+
+	TArray<UClass*> RowClasses;
+	RowClasses.Reserve(ItemSampler.Num());
+	for (int32 i = 0; i < ItemSampler.Num(); i++)
+	{
+		RowClasses.Add(ResolveItemClass(*ItemSampler.GetRow(i)));
+	}
+
+	if (ItemSampler.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SpawnVolume] %s has no item rows for Level %d Wave %d"), *GetName(), LevelIndex + 1, WaveIndex + 1);
+	}
+
+	// 클래스는 테이블 로드 핸들이 유지하므로 워커에서는 포인터만 복사해 사용
+	return Async(EAsyncExecution::TaskGraph, [Params = MakePlacementParams(), Sampler = ItemSampler, RowClasses = MoveTemp(RowClasses), Count, Seed]()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::BuildWaveManifest);
+
+		const FRandomStream Stream(Seed);
+		TArray<FVector> Points;
+		GetPlacementPoints(Params, Count, Stream, Points);
+
+		FWaveManifest Manifest;
+		Manifest.bGrounded = Params.BakedPoints.Num() > 0;
+		Manifest.Entries.Reserve(Points.Num());
+		for (const FVector& Point : Points)
+		{
+			const int32 RowIndex = Sampler.SampleIndex(Stream.FRand());
+
+			FWaveManifestEntry& Entry = Manifest.Entries.AddDefaulted_GetRef();
+			Entry.ItemClass = RowClasses.IsValidIndex(RowIndex) ? RowClasses[RowIndex] : nullptr;
+			Entry.Location = Point;
+			// 같은 종류의 아이템이 모두 같은 방향으로 회전하지 않도록 시작 Yaw를 흩뜨림
+			Entry.Rotation = FRotator(0.f, Stream.FRandRange(0.f, 360.f), 0.f);
+		}
+		return Manifest;
+	});
+}
+
+void ASpawnVolume::ResolveManifest(FWaveManifest&& Manifest, FOnManifestReady OnReady)
+{
+	// 구워둔 위치는 이미 바닥 위이므로 탐색 없이, 비동기 탐색과 같이 다음 프레임에 전달
+	if (Manifest.bGrounded || Manifest.Entries.Num() == 0)
+	{
+		GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [OnReady = MoveTemp(OnReady), Entries = MoveTemp(Manifest.Entries)]()
+		{
+			OnReady.ExecuteIfBound(Entries);
+		}));
+		return;
+	}
+
+	const uint32 BatchId = NextSpawnPointBatchId++;
+	FPendingSpawnPoints& Batch = PendingSpawnPoints.Add(BatchId);
+	// 바닥을 찾지 못하면 원래 위치를 그대로 사용
+	Batch.Entries = MoveTemp(Manifest.Entries);
+	Batch.NumPendingTraces = Batch.Entries.Num();
+	Batch.OnReady = MoveTemp(OnReady);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SpawnVolumeFloorTrace));
+	QueryParams.AddIgnoredActor(this);
+
+	// 배치 전체가 하나의 델리게이트를 공유하고, UserData로 몇 번째 위치인지 구분
+	const FTraceDelegate TraceDelegate = FTraceDelegate::CreateUObject(this, &ASpawnVolume::OnFloorTraceDone, BatchId);
+
+	for (int32 i = 0; i < Batch.Entries.Num(); i++)
+	{
+		FVector TraceStart;
+		FVector TraceEnd;
+		GetFloorTraceSegment(Batch.Entries[i].Location, TraceStart, TraceEnd);
+
+		GetWorld()->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single,
+			TraceStart,
+			TraceEnd,
+			ECC_Visibility,
+			QueryParams,
+			FCollisionResponseParams::DefaultResponseParam,
+			&TraceDelegate,
+			static_cast<uint32>(i));
+	}
+}
+
+ASpawnVolume::FPlacementParams ASpawnVolume::MakePlacementParams() const
+{
+	FPlacementParams Params;
+	Params.VolumeName = GetName();
+	Params.BoxOrigin = SpawningBox->GetComponentLocation();
+	Params.BoxExtent = SpawningBox->GetScaledBoxExtent();
+	Params.PlacementMode = PlacementMode;
+	Params.MinItemSeparation = MinItemSeparation;
+
+	if (HasBakedSpawnPoints())
+	{
+		const FTransform& ActorTransform = GetActorTransform();
+		Params.BakedPoints.Reserve(BakedSpawnPoints.Num());
+		for (const FVector3f& BakedPoint : BakedSpawnPoints)
+		{
+			Params.BakedPoints.Add(ActorTransform.TransformPosition(FVector(BakedPoint)));
+		}
+	}
+	return Params;
+}
+
+void ASpawnVolume::GetPlacementPoints(const FPlacementParams& Params, int32 Count, const FRandomStream& Stream, TArray<FVector>& OutPoints)
+{
+	// 구워둔 위치가 있으면 바닥 탐색 없이 그 중에서 선택
+	if (Params.BakedPoints.Num() > 0)
+	{
+		DrawBakedSpawnPoints(Params, Count, Stream, OutPoints);
+	}
+	else
+	{
+		GetBoxPlacementPoints(Params, Count, Stream, OutPoints);
+	}
+}
+
+void ASpawnVolume::DrawBakedSpawnPoints(const FPlacementParams& Params, int32 Count, const FRandomStream& Stream, TArray<FVector>& OutPoints)
+{
+	TArray<FVector> Candidates = Params.BakedPoints;
+	FBox2D Bounds(ForceInit);
+	for (const FVector& Candidate : Candidates)
+	{
+		Bounds += FVector2D(Candidate);
+	}
+
+	// 구워둔 위치를 무작위 순서로 섞음
+	for (int32 i = Candidates.Num() - 1; i > 0; i--)
+	{
+		Candidates.Swap(i, Stream.RandRange(0, i));
+	}
+
+	OutPoints.Reset(Count);
+
+	// 블루 노이즈 배치면 최소 간격을 지키는 위치만 먼저 선택 (격자 검사라 후보 수에 선형)
+	FPoissonDiscGrid Grid;
+	if (Params.PlacementMode == ESpawnPlacementMode::PoissonDisc && Grid.Init(Bounds, Params.MinItemSeparation))
+	{
+		TArray<FVector> Rejected;
+		for (const FVector& Candidate : Candidates)
+		{
+			if (OutPoints.Num() >= Count)
+				break;
+
+			if (Grid.IsFarEnough(FVector2D(Candidate)))
+			{
+				Grid.Add(FVector2D(Candidate));
+				OutPoints.Add(Candidate);
+			}
+			else
+			{
+				Rejected.Add(Candidate);
+			}
+		}
+
+		if (OutPoints.Num() < Count)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] %s fits only %d of %d items at separation %.0f"),
+				*Params.VolumeName, OutPoints.Num(), Count, Params.MinItemSeparation);
+		}
+
+		// 모자란 개수는 간격을 못 지킨 위치로 채움
+		Candidates = Rejected.Num() > 0 ? MoveTemp(Rejected) : OutPoints;
+	}
+
+	// 한 바퀴를 다 쓰면 같은 위치를 다시 사용
+	for (int32 i = 0; OutPoints.Num() < Count && Candidates.Num() > 0; i = (i + 1) % Candidates.Num())
+	{
+		OutPoints.Add(Candidates[i]);
+	}
+}
+
+void ASpawnVolume::GetBoxPlacementPoints(const FPlacementParams& Params, int32 Count, const FRandomStream& Stream, TArray<FVector>& OutPoints)
+{
+	OutPoints.Reset(Count);
+
+	const FVector& BoxExtent = Params.BoxExtent;
+	const FVector& BoxOrigin = Params.BoxOrigin;
+
+	if (Params.PlacementMode == ESpawnPlacementMode::PoissonDisc)
+	{
+		const FBox2D Footprint(FVector2D(BoxOrigin - BoxExtent), FVector2D(BoxOrigin + BoxExtent));
+
+		// 바닥 면적에 비해 개수가 적으면 무작위로 던져 Count개가 모이는 즉시 멈춤
+		TArray<FVector2D> DiscPoints;
+		bool bGenerated = false;
+		if (Count * 2 <= FPoissonDiscSampler::EstimateCapacity(Footprint, Params.MinItemSeparation))
+		{
+			bGenerated = FPoissonDiscSampler::GenerateCount(Footprint, Params.MinItemSeparation, Count, Stream, DiscPoints);
+		}
+
+		// 개수가 많거나 무작위로 다 못 모았으면 바닥 면적을 가득 채운 뒤, 그 중 Count개를 골라 볼륨 전체에 고르게 퍼지도록
+		if (!bGenerated || DiscPoints.Num() < Count)
+		{
+			bGenerated = FPoissonDiscSampler::Generate(Footprint, Params.MinItemSeparation, Stream, DiscPoints);
+		}
+
+		if (bGenerated)
+		{
+			const int32 NumToUse = FMath::Min(Count, DiscPoints.Num());
+			for (int32 i = 0; i < NumToUse; i++)
+			{
+				DiscPoints.Swap(i, Stream.RandRange(i, DiscPoints.Num() - 1));
+				OutPoints.Add(FVector(DiscPoints[i], BoxOrigin.Z + Stream.FRandRange(-BoxExtent.Z, BoxExtent.Z)));
+			}
+
+			if (NumToUse < Count)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] %s fits only %d of %d items at separation %.0f, placing the other %d without separation"),
+					*Params.VolumeName, NumToUse, Count, Params.MinItemSeparation, Count - NumToUse);
+			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] %s is too large for separation %.0f, using uniform placement"),
+				*Params.VolumeName, Params.MinItemSeparation);
+		}
+	}
+
+	// 균등 배치이거나 간격을 지키며 넣을 자리가 모자라면 나머지는 간격 없이 균등 무작위 (위에서 경고를 남김)
+	while (OutPoints.Num() < Count)
+	{
+		OutPoints.Add(BoxOrigin + FVector(
+			Stream.FRandRange(-BoxExtent.X, BoxExtent.X),
+			Stream.FRandRange(-BoxExtent.Y, BoxExtent.Y),
+			Stream.FRandRange(-BoxExtent.Z, BoxExtent.Z)));
+	}
+}
+
+void ASpawnVolume::BakeSpawnPoints()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	Modify();
+	BakedSpawnPoints.Reset(NumPointsToBake);
+
+	// 같은 볼륨은 항상 같은 결과가 나오도록 이름으로 시드 고정
+	SetSpawnSeed(static_cast<int32>(GetTypeHash(GetName())));
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SpawnVolumeBake));
+	QueryParams.AddIgnoredActor(this);
+
+	const FTransform& ActorTransform = GetActorTransform();
+	// 바닥이 없는 곳이 많을 수 있으므로 시도 횟수는 넉넉하게
+	const int32 MaxAttempts = NumPointsToBake * 4;
+	for (int32 Attempt = 0; Attempt < MaxAttempts && BakedSpawnPoints.Num() < NumPointsToBake; Attempt++)
+	{
+		FVector TraceStart;
+		FVector TraceEnd;
+		GetFloorTraceSegment(GetRandomPointInBox(), TraceStart, TraceEnd);
+
+		FHitResult HitResult;
+		if (World->LineTraceSingleByChannel(HitResult, TraceStart, TraceEnd, ECC_Visibility, QueryParams))
+		{
+			const FVector SpawnPoint = HitResult.Location + FVector(0.f, 0.f, SpawnHeightAboveFloor);
+			BakedSpawnPoints.Add(FVector3f(ActorTransform.InverseTransformPosition(SpawnPoint)));
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] %s baked %d / %d spawn points"), *GetName(), BakedSpawnPoints.Num(), NumPointsToBake);
+}
+
+void ASpawnVolume::OnFloorTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, uint32 BatchId)
+{
+	FPendingSpawnPoints* Batch = PendingSpawnPoints.Find(BatchId);
+	if (!Batch)
+		return;
+
+	const int32 PointIndex = static_cast<int32>(TraceDatum.UserData);
+	if (Batch->Entries.IsValidIndex(PointIndex) && TraceDatum.OutHits.Num() > 0 && TraceDatum.OutHits[0].bBlockingHit)
+	{
+		// 바닥 위 50 유닛 높이에 스폰
+		Batch->Entries[PointIndex].Location = TraceDatum.OutHits[0].Location + FVector(0.f, 0.f, SpawnHeightAboveFloor);
+	}
+
+	if (--Batch->NumPendingTraces > 0)
+		return;
+
+	// 마지막 결과가 도착하면 배치를 꺼내서 전달 (콜백 안에서 새 요청을 해도 안전하도록)
+	FPendingSpawnPoints CompletedBatch = MoveTemp(*Batch);
+	PendingSpawnPoints.Remove(BatchId);
+	CompletedBatch.OnReady.ExecuteIfBound(CompletedBatch.Entries);
+}
+
+FItemSpawnRow* ASpawnVolume::GetRandomItem() const
+{
+	SCOPE_CYCLE_COUNTER(STAT_Sparta_GetRandomItem);
+	TRACE_CPUPROFILER_EVENT_SCOPE(ASpawnVolume::GetRandomItem);
+
+	// 현재 설정된 DataTable 사용
+	if (!CurrentItemDataTable)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[SpawnVolume] CurrentItemDataTable is NULL!"));
+		return nullptr;
+	}
+
+	// 미리 만들어둔 Alias Table에서 O(1)로 선택
+	return ItemSampler.Sample(SpawnStream.FRand());
+}
+
+AActor* ASpawnVolume::SpawnItem(TSubclassOf<AActor> ItemClass)
+{
+	if (!ItemClass)
+		return nullptr;
+
+	return SpawnItemAt(ItemClass, GetRandomPointInVolume());
+}
+
+AActor* ASpawnVolume::SpawnItemAt(TSubclassOf<AActor> ItemClass, const FVector& Location, const FRotator& Rotation)
+{
+	if (!ItemClass)
+		return nullptr;
+
+	// BaseItem 계열은 풀을 통해 재사용
+	if (ItemClass->IsChildOf(ABaseItem::StaticClass()))
+	{
+		return AcquireItem(ItemClass, Location, Rotation);
+	}
+
+	AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(
+		ItemClass,
+		Location,
+		Rotation);
+
+	return SpawnedActor;
+}
+
+void ASpawnVolume::PrewarmPool()
+{
+	// 아직 로드되지 않은 테이블은 로드가 끝날 때 채움
+	for (const TSoftObjectPtr<UDataTable>& DataTable : ItemDataTables)
+	{
+		PrewarmPoolForTable(DataTable.Get());
+	}
+}
+
+void ASpawnVolume::PrewarmPoolForTable(const UDataTable* DataTable)
+{
+	if (!DataTable)
+		return;
+
+	// 클래스별로 한 웨이브에서 필요할 것으로 예상되는 최대 개수 계산
+	TMap<UClass*, int32> RequiredCounts;
+	static const FString ContextString(TEXT("ItemPoolPrewarm"));
+
+	TArray<FItemSpawnRow*> AllRows;
+	DataTable->GetAllRows(ContextString, AllRows);
+
+	float TotalChance = 0.f;
+	for (const FItemSpawnRow* Row : AllRows)
+	{
+		if (Row)
+		{
+			TotalChance += Row->SpawnChance;
+		}
+	}
+
+	if (TotalChance <= 0.f)
+		return;
+
+	for (const FItemSpawnRow* Row : AllRows)
+	{
+		// 로드된 클래스만 사용 (프리웜 때문에 동기 로드하지 않음)
+		UClass* ItemClass = Row ? Row->ItemClass.Get() : nullptr;
+		if (!ItemClass || !ItemClass->IsChildOf(ABaseItem::StaticClass()))
+			continue;
+
+		const int32 Expected = FMath::CeilToInt(PoolPrewarmItemCount * Row->SpawnChance / TotalChance);
+		int32& Required = RequiredCounts.FindOrAdd(ItemClass);
+		Required = FMath::Max(Required, Expected);
+	}
+
+	int32 NumCreated = 0;
+	for (const TPair<UClass*, int32>& Pair : RequiredCounts)
+	{
+		FItemPool& Pool = ItemPools.FindOrAdd(Pair.Key);
+		Pool.FreeItems.Reserve(Pair.Value);
+
+		for (int32 i = Pool.FreeItems.Num(); i < Pair.Value; i++)
+		{
+			if (ABaseItem* Item = CreatePooledItem(Pair.Key, GetActorLocation(), FRotator::ZeroRotator))
+			{
+				Item->OnReleasedToPool();
+				Pool.FreeItems.Add(Item);
+				PoolStats.NumAvailable++;
+				NumCreated++;
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[SpawnVolume] Pool prewarmed from %s: %d classes, %d new items"),
+		*DataTable->GetName(), RequiredCounts.Num(), NumCreated);
+}
+
+ABaseItem* ASpawnVolume::AcquireItem(UClass* ItemClass, const FVector& Location, const FRotator& Rotation)
+{
+	FItemPool& Pool = ItemPools.FindOrAdd(ItemClass);
+
+	while (Pool.FreeItems.Num() > 0)
+	{
+		ABaseItem* Item = Pool.FreeItems.Pop(EAllowShrinking::No);
+		PoolStats.NumAvailable--;
+
+		if (!IsValid(Item))
+			continue;
+
+		// 충돌이 꺼진 상태에서 이동한 뒤 활성화해야 이전 위치에서 Overlap이 발생하지 않음
+		Item->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+		Item->OnAcquiredFromPool();
+
+		PoolStats.NumReused++;
+		PoolStats.NumActive++;
+		INC_DWORD_STAT(STAT_Sparta_LiveItems);
+		ActiveItems.Add(Item);
+		return Item;
+	}
+
+	// 풀이 비어 있으면 새로 생성
+	ABaseItem* Item = CreatePooledItem(ItemClass, Location, Rotation);
+	if (Item)
+	{
+		PoolStats.NumActive++;
+		INC_DWORD_STAT(STAT_Sparta_LiveItems);
+		ActiveItems.Add(Item);
+	}
+	return Item;
+}
+
+ABaseItem* ASpawnVolume::CreatePooledItem(UClass* ItemClass, const FVector& Location, const FRotator& Rotation)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = this;
+	// 볼륨과 같은 레벨에 생성해서 스트리밍 레벨이 언로드될 때 함께 정리되도록
+	SpawnParams.OverrideLevel = GetLevel();
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ABaseItem* Item = GetWorld()->SpawnActor<ABaseItem>(
+		ItemClass,
+		Location,
+		Rotation,
+		SpawnParams);
+
+	if (Item)
+	{
+		PoolStats.NumCreated++;
+	}
+	return Item;
+}
+
+void ASpawnVolume::ReleaseItem(ABaseItem* Item)
+{
+	if (!IsValid(Item) || Item->IsInPool())
+		return;
+
+	Item->OnReleasedToPool();
+	ItemPools.FindOrAdd(Item->GetClass()).FreeItems.Add(Item);
+	ActiveItems.Remove(Item);
+
+	PoolStats.NumReleased++;
+	PoolStats.NumActive--;
+	DEC_DWORD_STAT(STAT_Sparta_LiveItems);
+	PoolStats.NumAvailable++;
+}
+
+void ASpawnVolume::ReleaseAllItems()
+{
+	// ReleaseItem이 ActiveItems를 수정하므로 복사본으로 순회
+	const TArray<TObjectPtr<ABaseItem>> ItemsToRelease = ActiveItems.Array();
+	for (ABaseItem* Item : ItemsToRelease)
+	{
+		// KillZ 등으로 밖에서 파괴된 아이템은 풀로 돌릴 수 없으므로 활성 수만 맞춤
+		if (!IsValid(Item))
+		{
+			PoolStats.NumActive--;
+			DEC_DWORD_STAT(STAT_Sparta_LiveItems);
+			continue;
+		}
+
+		ReleaseItem(Item);
+	}
+	ActiveItems.Reset();
+}
+
+FItemPoolStats ASpawnVolume::GetPoolStats() const
+{
+	return PoolStats;
+}
@@ -0,0 +1,75 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpawnVolumeSubsystem.h"
+#include "SpawnVolume.h"
+#include "Algo/Sort.h"
+
+void USpawnVolumeSubsystem::RegisterVolume(ASpawnVolume* Volume)
+{
+	if (Volume)
+	{
+		Volumes.AddUnique(Volume);
+
+		// BeginPlay 순서와 상관없이 항상 같은 순서가 되도록 이름순 정렬 (시드 재현용)
+		Algo::Sort(Volumes, [](const TObjectPtr<ASpawnVolume>& A, const TObjectPtr<ASpawnVolume>& B)
+		{
+			return A->GetName() < B->GetName();
+		});
+	}
+}
+
+void USpawnVolumeSubsystem::UnregisterVolume(ASpawnVolume* Volume)
+{
+	Volumes.Remove(Volume);
+}
+
+void USpawnVolumeSubsystem::DistributeItemCount(int32 TotalCount, TArray<int32>& OutCounts) const
+{
+	const int32 NumVolumes = Volumes.Num();
+	OutCounts.Reset(NumVolumes);
+	OutCounts.AddZeroed(NumVolumes);
+
+	if (NumVolumes == 0 || TotalCount <= 0)
+		return;
+
+	float TotalWeight = 0.f;
+	for (const ASpawnVolume* Volume : Volumes)
+	{
+		TotalWeight += Volume ? Volume->GetSpawnWeight() : 0.f;
+	}
+
+	// 가중치가 모두 0이면 균등 분배
+	if (TotalWeight <= 0.f)
+	{
+		for (int32 i = 0; i < NumVolumes; i++)
+		{
+			OutCounts[i] = TotalCount / NumVolumes + (i < TotalCount % NumVolumes ? 1 : 0);
+		}
+		return;
+	}
+
+	// 최대 잉여 방식: 내림한 몫을 먼저 나눠주고, 남은 개수는 소수점이 큰 볼륨부터 하나씩
+	TArray<TPair<float, int32>> Remainders;
+	Remainders.Reserve(NumVolumes);
+
+	int32 Assigned = 0;
+	for (int32 i = 0; i < NumVolumes; i++)
+	{
+		const float Weight = Volumes[i] ? Volumes[i]->GetSpawnWeight() : 0.f;
+		const float Share = TotalCount * Weight / TotalWeight;
+		OutCounts[i] = FMath::FloorToInt32(Share);
+		Assigned += OutCounts[i];
+		Remainders.Emplace(Share - OutCounts[i], i);
+	}
+
+	Remainders.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key > B.Key;
+	});
+
+	for (int32 i = 0; Assigned < TotalCount; i = (i + 1) % NumVolumes)
+	{
+		OutCounts[Remainders[i].Value]++;
+		Assigned++;
+	}
+}
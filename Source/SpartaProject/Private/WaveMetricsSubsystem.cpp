@@ -0,0 +1,167 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "WaveMetricsSubsystem.h"
+#include "SpartaGameInstance.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(SpartaWave, true);
+
+namespace
+{
+	const TCHAR* WaveMetricsHeader = TEXT("Timestamp,Seed,Level,Wave,ItemCount,Duration,SpawnedCoins,CollectedCoins,EndReason,WaveSeconds,TimeToSpawnMs,AvgFrameMs,P99FrameMs,PeakActors,MemoryDeltaMB\n");
+}
+
+void UWaveMetricsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bWaveActive)
+		return;
+
+	// 시간 배율이 적용되지 않은 실제 프레임 시간
+	CurrentRecord.FrameTimesMs.Add(static_cast<float>(FApp::GetDeltaTime() * 1000.0));
+
+	const int32 ActorCount = GetWorld()->GetActorCount();
+	CurrentRecord.PeakActorCount = FMath::Max(CurrentRecord.PeakActorCount, ActorCount);
+	CSV_CUSTOM_STAT(SpartaWave, ActorCount, ActorCount, ECsvCustomStatOp::Set);
+}
+
+TStatId UWaveMetricsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWaveMetricsSubsystem, STATGROUP_Tickables);
+}
+
+void UWaveMetricsSubsystem::Deinitialize()
+{
+	// 웨이브 도중 월드가 내려가면 (게임 오버, 종료 등) 중단된 웨이브로 기록
+	if (bWaveActive)
+	{
+		FinishWave(TEXT("Aborted"));
+	}
+
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+	}
+
+	Super::Deinitialize();
+}
+
+bool UWaveMetricsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWaveMetricsSubsystem::BeginWave(int32 LevelIndex, int32 WaveIndex, int32 ItemCount, float Duration)
+{
+	if (bWaveActive)
+	{
+		FinishWave(TEXT("Aborted"));
+	}
+
+	CurrentRecord = FWaveRecord();
+	CurrentRecord.LevelIndex = LevelIndex;
+	CurrentRecord.WaveIndex = WaveIndex;
+	CurrentRecord.ItemCount = ItemCount;
+	CurrentRecord.Duration = Duration;
+	// 웨이브 제한 시간 동안 60fps 기준으로 미리 확보
+	CurrentRecord.FrameTimesMs.Reserve(FMath::CeilToInt32(Duration * 60.f));
+
+	WaveStartSeconds = FPlatformTime::Seconds();
+	WaveStartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+	bWaveActive = true;
+
+	CSV_EVENT(SpartaWave, TEXT("WaveStart L%d W%d"), LevelIndex + 1, WaveIndex + 1);
+}
+
+void UWaveMetricsSubsystem::MarkWavePopulated()
+{
+	if (bWaveActive && CurrentRecord.TimeToSpawnMs < 0.0)
+	{
+		CurrentRecord.TimeToSpawnMs = (FPlatformTime::Seconds() - WaveStartSeconds) * 1000.0;
+	}
+}
+
+void UWaveMetricsSubsystem::EndWave(int32 SpawnedCoinCount, int32 CollectedCoinCount, bool bAllCollected)
+{
+	if (!bWaveActive)
+		return;
+
+	CurrentRecord.SpawnedCoinCount = SpawnedCoinCount;
+	CurrentRecord.CollectedCoinCount = CollectedCoinCount;
+	FinishWave(bAllCollected ? TEXT("Collected") : TEXT("Timeout"));
+}
+
+void UWaveMetricsSubsystem::FinishWave(const TCHAR* EndReason)
+{
+	bWaveActive = false;
+
+	CurrentRecord.EndReason = EndReason;
+	CurrentRecord.WaveSeconds = FPlatformTime::Seconds() - WaveStartSeconds;
+	const int64 UsedPhysicalDelta = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(WaveStartUsedPhysical);
+	CurrentRecord.MemoryDeltaMB = UsedPhysicalDelta / (1024.0 * 1024.0);
+
+	CSV_EVENT(SpartaWave, TEXT("WaveEnd L%d W%d %s"), CurrentRecord.LevelIndex + 1, CurrentRecord.WaveIndex + 1, EndReason);
+
+	WriteRecordAsync(MoveTemp(CurrentRecord));
+	CurrentRecord = FWaveRecord();
+}
+
+void UWaveMetricsSubsystem::WriteRecordAsync(FWaveRecord&& Record)
+{
+	int32 Seed = 0;
+	if (USpartaGameInstance* SpartaGameInstance = Cast<USpartaGameInstance>(GetWorld()->GetGameInstance()))
+	{
+		Seed = SpartaGameInstance->SpawnSeed;
+	}
+
+	const FString FilePath = FPaths::ProfilingDir() / TEXT("SpartaWaveMetrics.csv");
+	const FString Timestamp = FDateTime::Now().ToString();
+
+	// 이전 기록이 먼저 파일에 붙도록 순서 보장 (웨이브 간격이 길어서 보통 이미 끝나 있음)
+	if (PendingWrite.IsValid())
+	{
+		PendingWrite.Wait();
+	}
+
+	PendingWrite = Async(EAsyncExecution::ThreadPool, [Record = MoveTemp(Record), FilePath, Timestamp, Seed]() mutable
+	{
+		double AvgFrameMs = 0.0;
+		double P99FrameMs = 0.0;
+		if (Record.FrameTimesMs.Num() > 0)
+		{
+			double TotalMs = 0.0;
+			for (float FrameMs : Record.FrameTimesMs)
+			{
+				TotalMs += FrameMs;
+			}
+			AvgFrameMs = TotalMs / Record.FrameTimesMs.Num();
+
+			Record.FrameTimesMs.Sort();
+			const int32 P99Index = FMath::Min(FMath::FloorToInt32(Record.FrameTimesMs.Num() * 0.99f), Record.FrameTimesMs.Num() - 1);
+			P99FrameMs = Record.FrameTimesMs[P99Index];
+		}
+
+		FString Line;
+		// 파일이 처음 만들어질 때만 헤더 추가
+		if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*FilePath))
+		{
+			Line = WaveMetricsHeader;
+		}
+
+		Line += FString::Printf(TEXT("%s,%d,%d,%d,%d,%.1f,%d,%d,%s,%.2f,%.2f,%.3f,%.3f,%d,%.2f\n"),
+			*Timestamp, Seed,
+			Record.LevelIndex + 1, Record.WaveIndex + 1, Record.ItemCount, Record.Duration,
+			Record.SpawnedCoinCount, Record.CollectedCoinCount, Record.EndReason,
+			Record.WaveSeconds, Record.TimeToSpawnMs, AvgFrameMs, P99FrameMs,
+			Record.PeakActorCount, Record.MemoryDeltaMB);
+
+		FFileHelper::SaveStringToFile(Line, *FilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	});
+}
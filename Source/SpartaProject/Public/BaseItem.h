@@ -1,61 +1,129 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "ItemInterface.h"
-#include "BaseItem.generated.h"
-
-class USphereComponent;
-
-UCLASS()
-class SPARTAPROJECT_API ABaseItem : public AActor, public IItemInterface
-{
-	GENERATED_BODY()
-
-public:
-	ABaseItem();
-
-	virtual void Tick(float DeltaTime) override;
-
-protected:
-	// 아이템 유형(타입)을 편집 가능하게 지정
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
-	FName ItemType;
-
-	// 루트 컴포넌트 (씬 컴포넌트)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
-	TObjectPtr<USceneComponent> Scene;
-	// 충돌 컴포넌트 (플레이어 진입 범위 감지)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
-	TObjectPtr<USphereComponent> Collision;
-	// 아이템 시각 표현용 스태틱 메시
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
-	TObjectPtr<UStaticMeshComponent> StaticMesh;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
-	TObjectPtr<UParticleSystem> PickupParticle;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
-	TObjectPtr<USoundBase> PickupSound;
-
-	// 회전 속도 (초당 회전 각도)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Rotation")
-	float RotationSpeed;
-
-	virtual void OnItemOverlap(
-		UPrimitiveComponent* OverlappedComp,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex,
-		bool bFromSweep,
-		const FHitResult& SweepResult) override;
-	virtual void OnItemEndOverlap(
-		UPrimitiveComponent* OverlappedComp,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex) override;
-	virtual void ActivateItem(AActor* Activator) override;
-	virtual FName GetItemType() const override;
-
-	virtual void DestroyItem();
-};
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ItemInterface.h"
+#include "BaseItem.generated.h"
+
+class USphereComponent;
+class UInstancedStaticMeshComponent;
+class UNiagaraSystem;
+class USoundConcurrency;
+
+UCLASS()
+class SPARTAPROJECT_API ABaseItem : public AActor, public IItemInterface
+{
+	GENERATED_BODY()
+
+	// 회전/상하 움직임은 UItemAnimationSubsystem이 일괄 처리
+	friend class UItemAnimationSubsystem;
+	// 픽업 판정은 UItemProximitySubsystem이 일괄 처리
+	friend class UItemProximitySubsystem;
+	// bUseMassSimulation 클래스는 액터 대신 클래스 기본값으로 엔티티를 만들어 처리
+	friend class UItemMassSubsystem;
+
+public:
+	ABaseItem();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 풀에서 꺼내져 다시 사용될 때 호출 (표시, 충돌, 애니메이션 복구 및 상태 초기화)
+	virtual void OnAcquiredFromPool();
+	// 풀로 반환될 때 호출 (숨김, 충돌/애니메이션 비활성화)
+	virtual void OnReleasedToPool();
+	// 현재 풀에 반환되어 대기 중인지 여부
+	bool IsInPool() const { return bIsInPool; }
+
+protected:
+	// 아이템 유형(타입)을 편집 가능하게 지정
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	FName ItemType;
+
+	// 루트 컴포넌트 (씬 컴포넌트)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
+	TObjectPtr<USceneComponent> Scene;
+	// 충돌 컴포넌트 (플레이어 진입 범위 감지)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
+	TObjectPtr<USphereComponent> Collision;
+	// 아이템 시각 표현용 스태틱 메시
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
+	TObjectPtr<UStaticMeshComponent> StaticMesh;
+	// 픽업 이펙트 (Niagara). 지정되지 않았으면 PickupParticle(Cascade)을 사용
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<UNiagaraSystem> PickupEffect;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<UParticleSystem> PickupParticle;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<USoundBase> PickupSound;
+	// 픽업 사운드 동시 재생 제한 (비워두면 아이템 종류별 기본 제한 사용, Sparta.PickupAudio.MaxVoicesPerType)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<USoundConcurrency> PickupSoundConcurrency;
+
+	// 회전 속도 (초당 회전 각도)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Rotation")
+	float RotationSpeed;
+	// 상하로 떠다니는 높이 (0이면 움직이지 않음)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Rotation")
+	float BobAmplitude;
+	// 초당 상하 왕복 횟수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Rotation")
+	float BobFrequency;
+
+	virtual void OnItemOverlap(
+		UPrimitiveComponent* OverlappedComp,
+		AActor* OtherActor,
+		UPrimitiveComponent* OtherComp,
+		int32 OtherBodyIndex,
+		bool bFromSweep,
+		const FHitResult& SweepResult) override;
+	virtual void OnItemEndOverlap(
+		UPrimitiveComponent* OverlappedComp,
+		AActor* OtherActor,
+		UPrimitiveComponent* OtherComp,
+		int32 OtherBodyIndex) override;
+	virtual void ActivateItem(AActor* Activator) override;
+	virtual FName GetItemType() const override;
+
+	virtual void DestroyItem();
+
+	// 픽업 이펙트와 사운드 재생 (Mass 아이템은 클래스 기본 객체로 호출하므로 월드를 따로 받음)
+	void PlayPickupFeedback(UWorld* World, const FVector& Location, const FRotator& Rotation) const;
+
+	// 플레이어가 조종하는 폰인지 (태그 비교 대신 컨트롤러로 확인)
+	static bool IsPlayerPawn(const AActor* Actor);
+
+	// 같은 클래스 아이템들과 하나의 인스턴스 메시로 그릴지 여부 (코인처럼 많이 스폰되는 아이템용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Rendering")
+	bool bUseInstancedRendering;
+	// 충돌 Overlap 대신 UItemProximitySubsystem의 격자 검사로 픽업할지 여부 (켜면 Collision 구는 반경 값으로만 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Item|Component")
+	bool bUseProximityPickup;
+	// 웨이브 스폰 시 액터 대신 Mass 엔티티로 만들지 여부 (코인/회복/지뢰만 지원, 아주 많이 스폰할 때 사용)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item|Mass")
+	bool bUseMassSimulation;
+
+private:
+	// 픽업 격자에 등록/해제
+	void RegisterProximity();
+	void UnregisterProximity();
+	// 인스턴스 메시 슬롯을 할당/반환
+	void AcquireRenderInstance();
+	void ReleaseRenderInstance();
+
+	bool bIsInPool;
+	// UItemAnimationSubsystem 배열에서의 위치 (등록되지 않았으면 INDEX_NONE)
+	int32 AnimationSlot;
+
+	// 픽업 격자에 등록된 위치/반경과 칸 정보 (등록되지 않았으면 ProximityIndex가 INDEX_NONE)
+	FVector ProximityLocation;
+	float ProximityRadius;
+	FIntVector ProximityCell;
+	int32 ProximityIndex;
+
+	// 인스턴스 렌더링 중일 때 사용하는 컴포넌트와 인스턴스 인덱스
+	UInstancedStaticMeshComponent* RenderInstanceComponent;
+	int32 RenderInstanceIndex;
+};
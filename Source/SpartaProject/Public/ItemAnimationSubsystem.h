@@ -0,0 +1,87 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "ItemInstancingSubsystem.h"
+#include "ItemAnimationSubsystem.generated.h"
+
+class ABaseItem;
+class UInstancedStaticMeshComponent;
+
+// 플레이어 시점에서 본 아이템의 중요도 (화면에서 차지하는 크기로 구분)
+enum class EItemSignificance : uint8
+{
+	// 지금처럼 매 프레임 갱신
+	Near,
+	// 회전/상하 움직임을 몇 프레임에 한 번만 반영하고 그림자 끔
+	Mid,
+	// 움직임 정지, 그림자 끔, 컬 거리 적용, Overlap 픽업 아이템은 충돌도 끔
+	Far
+};
+
+// 모든 아이템의 회전/상하 움직임을 한 번에 처리하는 서브시스템
+// 아이템마다 Tick을 돌리지 않고, 연속된 배열에 상태를 모아 프레임당 한 번 갱신
+// 주기적으로 플레이어 시점 기준 중요도를 다시 계산해 멀리 있는 아이템은 갱신/렌더 비용을 줄임
+UCLASS()
+class SPARTAPROJECT_API UItemAnimationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 아이템을 애니메이션 대상으로 등록 (현재 위치/회전을 기준으로 사용)
+	void RegisterItem(ABaseItem* Item);
+	void UnregisterItem(ABaseItem* Item);
+
+	int32 GetNumItems() const { return Items.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 플레이어 시점에서 모든 아이템의 중요도를 다시 계산
+	void UpdateSignificance();
+	// Slot 아이템에 중요도에 맞는 그림자/컬 거리/충돌 설정 적용
+	void ApplySignificance(int32 Slot, EItemSignificance NewSignificance);
+
+	// 아이템별 상태 (같은 인덱스끼리 한 아이템)
+	TArray<ABaseItem*> Items;
+	TArray<USceneComponent*> Roots;
+	TArray<FVector> BaseLocations;
+	TArray<float> Pitches;
+	TArray<float> Yaws;
+	TArray<float> Rolls;
+	TArray<float> YawSpeeds;
+	TArray<float> BobAmplitudes;
+	TArray<float> BobAngularSpeeds;
+	TArray<float> BobPhases;
+	// 이번 프레임에 계산된 상하 오프셋
+	TArray<float> BobOffsets;
+	// 인스턴스 렌더링 아이템이면 액터 대신 갱신할 인스턴스 (아니면 nullptr)
+	TArray<UInstancedStaticMeshComponent*> InstanceComponents;
+	TArray<int32> InstanceIndices;
+	// 루트 기준 메시의 상대 트랜스폼
+	TArray<FTransform> MeshOffsets;
+	// 중요도와 그 계산에 쓰는 메시 경계 구 반지름
+	TArray<EItemSignificance> Significances;
+	TArray<float> BoundsRadii;
+	// Near로 되돌릴 때 복원할 메시/충돌 원래 설정
+	TArray<bool> DefaultCastShadows;
+	TArray<float> DefaultDrawDistances;
+	TArray<ECollisionEnabled::Type> DefaultCollisionEnabled;
+
+	// 인스턴스 렌더링 아이템의 트랜스폼을 컴포넌트별로 모아 프레임당 한 번씩 반영
+	FItemInstanceTransformBatcher InstanceTransformBatcher;
+
+	// 상하 움직임 계산에 쓰는 누적 시간
+	float ElapsedTime = 0.f;
+	// 마지막 중요도 계산 이후 지난 시간
+	float TimeSinceSignificanceUpdate = 0.f;
+	// Mid 아이템을 프레임마다 나눠서 갱신하기 위한 프레임 번호
+	uint32 FrameCounter = 0;
+};
@@ -0,0 +1,53 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemEffectSubsystem.generated.h"
+
+class UFXSystemAsset;
+class UFXSystemComponent;
+class UNiagaraComponent;
+class UParticleSystemComponent;
+
+// 픽업/폭발 이펙트를 풀링된 컴포넌트로 재생하고, 이펙트별 동시 재생 수를 제한하는 서브시스템
+// 컴포넌트는 Niagara/Cascade 풀(AutoRelease)에서 빌려 쓰고, 수명 관리를 위한 타이머도 만들지 않음
+// 예산은 Sparta.ItemFX.* 콘솔 변수로 조정
+UCLASS()
+class SPARTAPROJECT_API UItemEffectSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// Niagara 또는 Cascade 이펙트 재생 (예산을 넘으면 재생하지 않음)
+	// TimeDilation은 Cascade 이펙트에만 적용
+	void SpawnEffect(UFXSystemAsset* Effect, const FVector& Location, const FRotator& Rotation, float TimeDilation = 1.f);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 이펙트 하나의 재생 중인 컴포넌트 목록
+	struct FActiveEffects
+	{
+		TArray<TWeakObjectPtr<UFXSystemComponent>> Components;
+		TArray<double> StartTimes;
+	};
+
+	// 끝났거나 수명이 다한 컴포넌트 정리
+	void PruneEffects(FActiveEffects& Active, double Now, bool bDeactivateExpired);
+
+	// 재생이 끝난 컴포넌트는 풀로 반환되어 다른 곳에 다시 빌려줄 수 있으므로 즉시 목록에서 제거
+	// (나중에 수명 만료로 비활성화할 때 다른 사용자의 이펙트를 끄지 않도록)
+	UFUNCTION()
+	void OnNiagaraFinished(UNiagaraComponent* Component);
+	UFUNCTION()
+	void OnParticleFinished(UParticleSystemComponent* Component);
+	void RemoveEffectComponent(UFXSystemComponent* Component);
+
+	TMap<TObjectKey<UFXSystemAsset>, FActiveEffects> ActiveEffects;
+};
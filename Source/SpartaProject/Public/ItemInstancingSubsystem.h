@@ -0,0 +1,75 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemInstancingSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+// 아이템 클래스 하나가 공유하는 인스턴스 메시와 비어 있는 인스턴스 슬롯
+USTRUCT()
+struct FItemInstanceBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<UInstancedStaticMeshComponent> Component;
+	// 반환되어 재사용을 기다리는 인스턴스 인덱스
+	TArray<int32> FreeIndices;
+};
+
+// 한 프레임 동안 바뀐 인스턴스 트랜스폼을 컴포넌트별로 모았다가 컴포넌트마다 BatchUpdateInstancesTransforms 한 번으로 반영
+// 인덱스가 연속이 아니므로 바뀐 인덱스의 최소~최대 범위를 현재 트랜스폼으로 채운 뒤 바뀐 것만 덮어써서 보냄
+struct SPARTAPROJECT_API FItemInstanceTransformBatcher
+{
+public:
+	void Add(UInstancedStaticMeshComponent* Component, int32 InstanceIndex, const FTransform& WorldTransform);
+	// 모아둔 갱신을 반영하고 비움
+	void Flush();
+
+private:
+	struct FPendingUpdate
+	{
+		int32 InstanceIndex;
+		FTransform WorldTransform;
+	};
+
+	TMap<UInstancedStaticMeshComponent*, TArray<FPendingUpdate>> PendingUpdates;
+	// 범위 트랜스폼을 채우는 작업 버퍼 (프레임마다 재할당하지 않도록 유지)
+	TArray<FTransform> RangeTransforms;
+};
+
+// 같은 클래스의 아이템 메시를 하나의 InstancedStaticMeshComponent로 그려주는 서브시스템
+// 인스턴스는 제거하지 않고 크기 0으로 숨겨 두었다가 재사용하므로 인덱스가 바뀌지 않음
+UCLASS()
+class SPARTAPROJECT_API UItemInstancingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// SourceMesh와 같은 모양의 인스턴스를 하나 할당
+	bool AcquireInstance(UClass* ItemClass, const UStaticMeshComponent* SourceMesh, const FTransform& WorldTransform,
+		UInstancedStaticMeshComponent*& OutComponent, int32& OutInstanceIndex);
+	// 인스턴스를 숨기고 빈 슬롯으로 반환
+	void ReleaseInstance(UClass* ItemClass, int32 InstanceIndex);
+
+	int32 GetNumActiveInstances() const { return NumActiveInstances; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UInstancedStaticMeshComponent* CreateInstanceComponent(const UStaticMeshComponent* SourceMesh);
+
+	// 인스턴스 메시 컴포넌트를 붙여둘 액터
+	UPROPERTY()
+	TObjectPtr<AActor> InstanceHost;
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FItemInstanceBatch> Batches;
+
+	int32 NumActiveInstances = 0;
+};
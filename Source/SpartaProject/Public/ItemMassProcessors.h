@@ -0,0 +1,101 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "ItemInstancingSubsystem.h"
+#include "ItemMassProcessors.generated.h"
+
+// Mass 아이템 프로세서들은 처리 단계에 자동 등록하지 않고 UItemMassSubsystem이 순서대로 직접 실행
+// 입력(플레이어 위치 등)은 실행 전에 채워두고, 게임 스레드에서 처리할 결과는 실행 후에 꺼내감
+
+// 회전/상하 움직임을 계산해 인스턴스 트랜스폼을 만드는 프로세서 (청크 단위 병렬)
+UCLASS()
+class SPARTAPROJECT_API UItemMassAnimationProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UItemMassAnimationProcessor();
+
+	// 상하 움직임 계산에 쓰는 누적 시간
+	float ElapsedTime = 0.f;
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+// 플레이어와 겹친 아이템을 찾는 프로세서 (청크 단위 병렬)
+UCLASS()
+class SPARTAPROJECT_API UItemMassPickupProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UItemMassPickupProcessor();
+
+	// 판정 대상 플레이어의 충돌 원기둥
+	struct FPlayerCylinder
+	{
+		FVector Location;
+		float Radius;
+		float HalfHeight;
+	};
+	TArray<FPlayerCylinder> Players;
+
+	// 이번 실행에서 획득 판정된 엔티티와 플레이어 인덱스
+	TArray<TPair<FMassEntityHandle, int32>> Pickups;
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+	FCriticalSection PickupsLock;
+};
+
+// 밟힌 지뢰의 폭발 대기 시간을 줄이는 프로세서
+UCLASS()
+class SPARTAPROJECT_API UItemMassFuseProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UItemMassFuseProcessor();
+
+	// 이번 실행에서 폭발 시간이 된 지뢰
+	TArray<FMassEntityHandle> Detonations;
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+// 계산된 트랜스폼을 인스턴스 메시에 반영하는 프로세서 (컴포넌트를 건드리므로 게임 스레드)
+UCLASS()
+class SPARTAPROJECT_API UItemMassRenderProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UItemMassRenderProcessor();
+
+protected:
+	virtual void ConfigureQueries() override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+	// 컴포넌트별 인스턴스 트랜스폼 갱신을 모으는 버퍼 (한 번의 Execute 안에서만 사용)
+	FItemInstanceTransformBatcher TransformBatcher;
+};
@@ -0,0 +1,92 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "ItemMassTypes.h"
+#include "ItemMassSubsystem.generated.h"
+
+class ABaseItem;
+class APawn;
+class UItemMassAnimationProcessor;
+class UItemMassPickupProcessor;
+class UItemMassFuseProcessor;
+class UItemMassRenderProcessor;
+struct FMassEntityManager;
+
+// bUseMassSimulation 아이템을 액터 없이 Mass 엔티티로 시뮬레이션하는 서브시스템
+// 움직임/픽업 판정/지뢰 대기 시간은 프로세서가 청크 단위로 처리하고, 점수/회복/데미지 적용만 게임 스레드에서 수행
+// 프로세서는 처리 단계에 등록하지 않고 매 프레임 여기서 순서대로 직접 실행
+UCLASS()
+class SPARTAPROJECT_API UItemMassSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ItemClass가 Mass 엔티티로 스폰되는 클래스인지
+	static bool UsesMassSimulation(const UClass* ItemClass);
+	// 엔티티 하나를 만들고 인스턴스 메시를 할당 (지원하지 않는 클래스면 false)
+	bool SpawnItem(UClass* ItemClass, const FVector& Location, const FRotator& Rotation);
+	// 모든 아이템 엔티티 제거 (레벨 전환/재시작 시)
+	void DestroyAllItems();
+
+	int32 GetNumItems() const { return LiveEntities.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 클래스별로 한 번만 계산해두는 정보 (메시/이펙트/효과 값은 클래스 기본 객체에서 가져옴)
+	struct FItemClassInfo
+	{
+		const ABaseItem* DefaultItem = nullptr;
+		FMassArchetypeHandle Archetype;
+		EItemMassKind Kind = EItemMassKind::Coin;
+		// 코인 점수 / 회복량 / 폭발 데미지
+		int32 Value = 0;
+		FTransform MeshOffset;
+		float PickupRadius = 0.f;
+		// 지뢰 폭발 대기 시간과 범위
+		float FuseDelay = 0.f;
+		float FuseRadius = 0.f;
+		// Mass로 처리할 수 있는지 (아이템 종류를 모르거나 인스턴스로 그릴 메시가 없으면 false)
+		// 지원하지 않는 클래스도 결과를 저장해두어 경고는 클래스당 한 번만 남김
+		bool bCanSimulate = false;
+	};
+
+	// ItemClass의 정보 인덱스 (처음이면 아키타입을 만들어 등록, 지원하지 않으면 INDEX_NONE)
+	int32 FindOrAddClassInfo(UClass* ItemClass);
+	FMassEntityManager* GetEntityManager() const;
+
+	// 프로세서 실행 결과를 게임 스레드에서 적용
+	void HandlePickups(const TArray<APawn*>& PlayerPawns);
+	void HandleDetonations(const TArray<APawn*>& PlayerPawns);
+	// 인스턴스를 반환하고 엔티티 제거
+	void DestroyItem(FMassEntityHandle Entity);
+
+	UPROPERTY()
+	TObjectPtr<UItemMassAnimationProcessor> AnimationProcessor;
+	UPROPERTY()
+	TObjectPtr<UItemMassPickupProcessor> PickupProcessor;
+	UPROPERTY()
+	TObjectPtr<UItemMassFuseProcessor> FuseProcessor;
+	UPROPERTY()
+	TObjectPtr<UItemMassRenderProcessor> RenderProcessor;
+
+	// 등록된 아이템 클래스 (엔티티에는 인덱스만 저장)
+	UPROPERTY()
+	TArray<TObjectPtr<UClass>> ItemClasses;
+	TArray<FItemClassInfo> ClassInfos;
+
+	TSet<FMassEntityHandle> LiveEntities;
+
+	// 상하 움직임 계산에 쓰는 누적 시간
+	float ElapsedTime = 0.f;
+};
@@ -0,0 +1,87 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "ItemMassTypes.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+// Mass로 시뮬레이션하는 아이템 종류 (픽업 시 게임 스레드에서 적용할 효과를 결정)
+UENUM()
+enum class EItemMassKind : uint8
+{
+	Coin,
+	Healing,
+	Mine
+};
+
+// 아이템 종류와 효과 값 (코인 점수 / 회복량 / 폭발 데미지)
+USTRUCT()
+struct FItemMassTypeFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	// UItemMassSubsystem에 등록된 아이템 클래스 인덱스 (메시/이펙트/사운드는 클래스 기본값을 사용)
+	int32 ClassIndex = INDEX_NONE;
+	EItemMassKind Kind = EItemMassKind::Coin;
+	int32 Value = 0;
+};
+
+// 스폰 위치와 픽업 반경
+USTRUCT()
+struct FItemMassLocationFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FVector BaseLocation = FVector::ZeroVector;
+	float PickupRadius = 0.f;
+};
+
+// 회전/상하 움직임 상태
+USTRUCT()
+struct FItemMassSpinFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	float Pitch = 0.f;
+	float Yaw = 0.f;
+	float Roll = 0.f;
+	float YawSpeed = 0.f;
+	float BobAmplitude = 0.f;
+	float BobAngularSpeed = 0.f;
+	float BobPhase = 0.f;
+};
+
+// 인스턴스 메시 슬롯과 이번 프레임에 반영할 트랜스폼
+USTRUCT()
+struct FItemMassRenderFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	// UItemInstancingSubsystem이 소유하는 컴포넌트 (월드가 살아있는 동안 유효)
+	UInstancedStaticMeshComponent* Component = nullptr;
+	int32 InstanceIndex = INDEX_NONE;
+	// 루트 기준 메시의 상대 트랜스폼
+	FTransform MeshOffset = FTransform::Identity;
+	FTransform InstanceTransform = FTransform::Identity;
+};
+
+// 지뢰 폭발 대기 시간과 범위 (지뢰 엔티티에만 있음)
+USTRUCT()
+struct FItemMassFuseFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	float Delay = 0.f;
+	float RemainingTime = 0.f;
+	float Radius = 0.f;
+};
+
+// 밟혀서 폭발을 기다리는 지뢰 (다시 픽업 판정하지 않음)
+USTRUCT()
+struct FItemMassArmedTag : public FMassTag
+{
+	GENERATED_BODY()
+};
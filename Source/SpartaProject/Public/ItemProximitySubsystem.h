@@ -0,0 +1,44 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemProximitySubsystem.generated.h"
+
+class ABaseItem;
+
+// 아이템 위치를 균일 격자(공간 해시)에 보관하고, 매 프레임 플레이어 주변 칸만 검사해 픽업을 처리하는 서브시스템
+// 아이템 수가 아니라 플레이어 수에 비례하는 비용으로 픽업 판정을 수행
+UCLASS()
+class SPARTAPROJECT_API UItemProximitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 아이템을 현재 위치의 칸에 등록
+	void RegisterItem(ABaseItem* Item);
+	void UnregisterItem(ABaseItem* Item);
+
+	int32 GetNumItems() const { return NumItems; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FIntVector GetCell(const FVector& Location) const;
+
+	// 칸 크기 (픽업 반경보다 크게 잡아 주변 칸 몇 개만 보면 되도록)
+	float CellSize = 250.f;
+	// 등록된 아이템 중 가장 큰 픽업 반경
+	float MaxItemRadius = 0.f;
+
+	TMap<FIntVector, TArray<ABaseItem*>> Cells;
+	int32 NumItems = 0;
+
+	// 이번 프레임에 획득 판정된 아이템과 획득한 플레이어 (판정 후 한꺼번에 처리)
+	TArray<TPair<ABaseItem*, AActor*>> PendingPickups;
+};
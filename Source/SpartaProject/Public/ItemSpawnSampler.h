@@ -0,0 +1,38 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ItemSpawnRow.h"
+
+class UDataTable;
+
+// SpawnChance 가중치로 Row를 O(1)에 뽑는 Alias Table (Vose 방식)
+// DataTable이 바뀔 때 한 번만 Build하고, 이후 Sample은 메모리 할당 없이 동작
+struct SPARTAPROJECT_API FItemSpawnSampler
+{
+public:
+	// DataTable의 모든 Row로 Alias Table 생성
+	void Build(UDataTable* DataTable);
+	void Reset();
+
+	bool IsEmpty() const { return Rows.IsEmpty(); }
+	int32 Num() const { return Rows.Num(); }
+	const UDataTable* GetSourceTable() const { return SourceTable; }
+
+	// [0, 1) 범위의 난수 하나로 Row 선택
+	FItemSpawnRow* Sample(float RandValue) const;
+	// Sample과 같지만 Row 인덱스를 반환 (비어 있으면 INDEX_NONE)
+	// Row를 건드리지 않으므로 복사본을 워커 스레드에서 사용할 수 있음
+	int32 SampleIndex(float RandValue) const;
+	FItemSpawnRow* GetRow(int32 Index) const { return Rows.IsValidIndex(Index) ? Rows[Index] : nullptr; }
+
+private:
+	TArray<FItemSpawnRow*> Rows;
+	// 각 칸에서 자기 자신이 선택될 확률
+	TArray<float> Probabilities;
+	// 자기 자신이 선택되지 않았을 때 대신 선택될 칸
+	TArray<int32> Aliases;
+
+	const UDataTable* SourceTable = nullptr;
+};
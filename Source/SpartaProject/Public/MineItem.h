@@ -1,44 +1,52 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "BaseItem.h"
-#include "MineItem.generated.h"
-
-UCLASS()
-class SPARTAPROJECT_API AMineItem : public ABaseItem
-{
-	GENERATED_BODY()
-
-public:
-	AMineItem();
-
-protected:
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Component")
-	TObjectPtr<USphereComponent> ExplosionCollision;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
-	TObjectPtr<UParticleSystem> ExplosionParticle;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
-	TObjectPtr<USoundBase> ExplosionSound;
-
-	// 폭발까지 걸리는 시간
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mine")
-	float ExplosionDelay;
-
-	// 폭발 범위
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mine")
-	float ExplosionRadius;
-
-	// 폭발 데미지
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mine")
-	int32 ExplosionDamage;
-
-	// 지뢰 발동 여부
-	bool bHasExploded;
-	FTimerHandle ExplosionTimerHandle;
-
-	virtual void ActivateItem(AActor* Activator) override;
-
-	void Explode();
-};
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseItem.h"
+#include "MineItem.generated.h"
+
+UCLASS()
+class SPARTAPROJECT_API AMineItem : public ABaseItem
+{
+	GENERATED_BODY()
+
+	// Mass 지뢰는 클래스 기본값의 폭발 설정을 사용
+	friend class UItemMassSubsystem;
+
+public:
+	AMineItem();
+
+	virtual void OnAcquiredFromPool() override;
+
+protected:
+	// 폭발 이펙트 (Niagara). 지정되지 않았으면 ExplosionParticle(Cascade)을 사용
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<UNiagaraSystem> ExplosionEffect;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<UParticleSystem> ExplosionParticle;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item|Effects")
+	TObjectPtr<USoundBase> ExplosionSound;
+
+	// 폭발까지 걸리는 시간
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mine")
+	float ExplosionDelay;
+
+	// 폭발 범위
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mine")
+	float ExplosionRadius;
+
+	// 폭발 데미지
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mine")
+	int32 ExplosionDamage;
+
+	// 지뢰 발동 여부
+	bool bHasExploded;
+	FTimerHandle ExplosionTimerHandle;
+
+	virtual void ActivateItem(AActor* Activator) override;
+
+	void Explode();
+	// 폭발 이펙트와 사운드 재생 (Mass 지뢰는 클래스 기본 객체로 호출하므로 월드를 따로 받음)
+	void PlayExplosionFeedback(UWorld* World, const FVector& Location, const FRotator& Rotation) const;
+};
@@ -0,0 +1,61 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PickupAudioSubsystem.generated.h"
+
+class USoundBase;
+class USoundConcurrency;
+
+// 픽업 사운드를 아이템 종류별로 관리하는 서브시스템
+// 짧은 시간 안에 연달아 주운 아이템은 하나의 사운드로 합치고, 연속 횟수에 따라 피치/볼륨을 올림
+// 사운드는 오디오 컴포넌트나 타이머 없이 fire-and-forget으로 재생
+// 아이템에 동시 재생 설정이 없으면 종류별 기본 설정을 만들어 동시 재생 수를 제한
+UCLASS()
+class SPARTAPROJECT_API UPickupAudioSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void PlayPickupSound(USoundBase* Sound, FName ItemType, const FVector& Location, USoundConcurrency* Concurrency);
+
+	// 이 시간 안에 들어온 같은 종류의 픽업은 하나로 합침 (초)
+	float CoalesceWindow = 0.08f;
+	// 연속 픽업 한 단계마다 올라가는 피치/볼륨
+	float PitchStep = 0.05f;
+	float VolumeStep = 0.05f;
+	// 피치/볼륨이 최대로 올라가는 연속 단계 수
+	int32 MaxEscalationSteps = 6;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 아이템 종류 하나의 재생 상태
+	struct FPickupSoundState
+	{
+		TWeakObjectPtr<USoundBase> Sound;
+		TWeakObjectPtr<USoundConcurrency> Concurrency;
+		FVector LastLocation = FVector::ZeroVector;
+		// 현재 합치기 구간이 시작된 시간
+		double WindowStartTime = -1.0;
+		// 현재 구간에서 아직 재생하지 않은 픽업 수
+		int32 NumPending = 0;
+		// 끊기지 않고 이어진 연속 단계
+		int32 EscalationStep = 0;
+	};
+
+	void PlayCue(FPickupSoundState& State, double Now);
+	// ItemType 전용 기본 동시 재생 설정 (처음이면 생성)
+	USoundConcurrency* GetDefaultConcurrency(FName ItemType);
+
+	TMap<FName, FPickupSoundState> SoundStates;
+
+	UPROPERTY(Transient)
+	TMap<FName, TObjectPtr<USoundConcurrency>> DefaultConcurrencies;
+};
@@ -0,0 +1,45 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 2D 점들 사이의 최소 거리를 격자로 검사하는 도우미 (Bridson 방식)
+// 칸 크기가 Radius / sqrt(2)라서 칸마다 점이 최대 하나이고, 주변 5x5 칸만 보면 됨
+struct SPARTAPROJECT_API FPoissonDiscGrid
+{
+public:
+	// 격자가 너무 크면 (반경에 비해 영역이 지나치게 넓으면) false
+	bool Init(const FBox2D& InBounds, float InRadius);
+
+	bool IsFarEnough(const FVector2D& Point) const;
+	void Add(const FVector2D& Point);
+
+	const TArray<FVector2D>& GetPoints() const { return Points; }
+
+private:
+	FIntPoint GetCell(const FVector2D& Point) const;
+
+	FBox2D Bounds;
+	float Radius = 0.f;
+	float CellSize = 0.f;
+	int32 GridWidth = 0;
+	int32 GridHeight = 0;
+	// 칸마다 들어있는 점의 인덱스 (없으면 INDEX_NONE)
+	TArray<int32> Cells;
+	TArray<FVector2D> Points;
+};
+
+// 최소 간격 Radius를 지키는 블루 노이즈 점 집합을 선형 시간에 생성 (Bridson 알고리즘)
+struct SPARTAPROJECT_API FPoissonDiscSampler
+{
+	// Bounds 영역을 가득 채울 때까지 점을 생성 (영역이 너무 넓어 격자를 만들 수 없으면 false)
+	static bool Generate(const FBox2D& Bounds, float Radius, const FRandomStream& Stream, TArray<FVector2D>& OutPoints);
+
+	// 영역 전체에 무작위로 점을 던져 간격을 지키는 점이 MaxPoints개 모이면 멈춤
+	// MaxPoints가 영역을 채우는 개수보다 훨씬 적을 때 전체를 채우지 않기 위한 용도이며, 시도 횟수 안에 다 못 모으면 모은 만큼만 반환
+	static bool GenerateCount(const FBox2D& Bounds, float Radius, int32 MaxPoints, const FRandomStream& Stream, TArray<FVector2D>& OutPoints);
+
+	// Generate로 영역을 가득 채웠을 때의 대략적인 점 개수
+	static int32 EstimateCapacity(const FBox2D& Bounds, float Radius);
+};
@@ -1,17 +1,17 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "CoinItem.h"
-#include "SmallCoinItem.generated.h"
-
-UCLASS()
-class SPARTAPROJECT_API ASmallCoinItem : public ACoinItem
-{
-	GENERATED_BODY()
-
-public:
-	ASmallCoinItem();
-	virtual void ActivateItem(AActor* Activator) override;
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoinItem.h"
+#include "SmallCoinItem.generated.h"
+
+UCLASS()
+class SPARTAPROJECT_API ASmallCoinItem : public ACoinItem
+{
+	GENERATED_BODY()
+
+public:
+	ASmallCoinItem();
+	virtual void ActivateItem(AActor* Activator) override;
 };
\ No newline at end of file
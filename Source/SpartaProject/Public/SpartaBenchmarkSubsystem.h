@@ -0,0 +1,57 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpartaBenchmarkSubsystem.generated.h"
+
+class ASpawnVolume;
+class ABaseItem;
+
+// 스폰/픽업 핫패스 성능을 측정하는 서브시스템
+// 콘솔 명령 Sparta.Benchmark 로 실행하며, 각 항목을 여러 번 측정한 중앙값을 JSON으로 저장하고 기준값(Baseline)과 비교
+// 현재 맵에 SpawnVolume이 없으면(메뉴 등) 벤치마크 맵(기본 BasicLevel)을 연 뒤 실행
+// 무인 실행 예: UnrealEditor-Cmd SpartaProject.uproject /Game/Maps/BasicLevel -game -nullrhi -unattended -ExecCmds="Sparta.Benchmark"
+//   (기준값보다 Tolerance 이상 느려지거나 기준값 파일이 없으면 종료 코드 1로 종료)
+// 기준값은 기준 머신에서 UpdateBaseline으로 기록한 결과만 의미가 있으므로 저장소에 기본값을 두지 않음
+//   기록한 파일에는 엔진 버전/빌드 구성/CPU/측정 횟수가 함께 저장되고, 다른 환경에서 비교하면 경고
+// 측정하는 동안 GameState의 웨이브 진행을 멈추므로 실제 게임 맵에서 실행해도 점수/웨이브 상태가 바뀌지 않음
+UCLASS()
+class SPARTAPROJECT_API USpartaBenchmarkSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// SpawnVolume이 있는 벤치마크 맵 (Map= 인자로 변경 가능)
+	static const TCHAR* const DefaultMapName;
+	// 기준값 파일 기본 경로 (프로젝트 폴더 기준, 기준 머신에서 기록한 뒤 커밋)
+	static FString GetDefaultBaselinePath();
+
+	// Args: Tolerance=0.15 Runs=5 Baseline=<경로> UpdateBaseline
+	// 반환값: 기준값 대비 성능 저하가 없으면 true
+	bool RunBenchmark(const TArray<FString>& Args);
+
+	// 이 월드에서 측정할 수 있는지 (SpawnVolume이 있는지)
+	bool HasSpawnVolume() const { return FindSpawnVolume() != nullptr; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 측정 항목 이름 -> 소요 시간(ms)
+	using FBenchmarkResults = TArray<TPair<FString, double>>;
+
+	ASpawnVolume* FindSpawnVolume() const;
+
+	void MeasureGetRandomItem(ASpawnVolume* Volume, FBenchmarkResults& OutResults) const;
+	// Count개짜리 웨이브 매니페스트를 만들어 스폰하고, 그 상태에서 애니메이션 Tick/코인 픽업 비용까지 측정
+	void MeasureSpawnTickAndPickup(ASpawnVolume* Volume, int32 Count, FBenchmarkResults& OutResults) const;
+
+	// 여러 번 측정한 결과에서 항목별 중앙값
+	static FBenchmarkResults GetMedianResults(const TArray<FBenchmarkResults>& Runs);
+
+	void WriteResults(const FString& FilePath, const FBenchmarkResults& Results, int32 NumRuns) const;
+	// 기준값과 비교해 Tolerance 이상 느려진 항목이 있으면 false
+	bool CompareWithBaseline(const FString& BaselinePath, const FBenchmarkResults& Results, double Tolerance) const;
+};
@@ -1,64 +1,67 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/Character.h"
-#include "InputActionValue.h"
-#include "SpartaCharacter.generated.h"
-
-class USpringArmComponent;
-class UCameraComponent;
-class UWidgetComponent;
-
-UCLASS()
-class SPARTAPROJECT_API ASpartaCharacter : public ACharacter
-{
-	GENERATED_BODY()
-
-public:
-	ASpartaCharacter();
-
-	virtual void BeginPlay() override;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
-	TObjectPtr<USpringArmComponent> SpringArmComp;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
-	TObjectPtr<UCameraComponent> CameraComp;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-	TObjectPtr<UWidgetComponent> OverheadWidget;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
-	float NormalSpeed;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
-	float SprintSpeed;
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
-	float SprintSpeedMultiplier;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health")
-	float MaxHealth;
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Health")
-	float Health;
-
-	UFUNCTION(BlueprintPure, Category = "Health")
-	int32 GetHealth() const;
-	UFUNCTION(BlueprintCallable, Category = "Health")
-	void AddHealth(int32 Amount);
-	UFUNCTION(BlueprintPure, Category = "Health")
-	float GetHealthPercent() const { return Health / MaxHealth; }
-
-	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
-
-	void Move(const FInputActionValue& value);
-	void StartJump(const FInputActionValue& value);
-	void StopJump(const FInputActionValue& value);
-	void Look(const FInputActionValue& value);
-	void StartSprint(const FInputActionValue& value);
-	void StopSprint(const FInputActionValue& value);
-	void OnDeath();
-	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInsigator, AActor* DamageCauser) override;
-
-	void UpdateOverheadHP();
-};
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Character.h"
+#include "InputActionValue.h"
+#include "SpartaCharacter.generated.h"
+
+class USpringArmComponent;
+class UCameraComponent;
+class UWidgetComponent;
+
+UCLASS()
+class SPARTAPROJECT_API ASpartaCharacter : public ACharacter
+{
+	GENERATED_BODY()
+
+public:
+	ASpartaCharacter();
+
+	virtual void BeginPlay() override;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
+	TObjectPtr<USpringArmComponent> SpringArmComp;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Camera")
+	TObjectPtr<UCameraComponent> CameraComp;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
+	TObjectPtr<UWidgetComponent> OverheadWidget;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+	float NormalSpeed;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+	float SprintSpeed;
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Movement")
+	float SprintSpeedMultiplier;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Health")
+	float MaxHealth;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Health")
+	float Health;
+
+	UFUNCTION(BlueprintPure, Category = "Health")
+	int32 GetHealth() const;
+	UFUNCTION(BlueprintCallable, Category = "Health")
+	void AddHealth(int32 Amount);
+	// 체력을 최대치로 되돌림 (레벨 전환, 재시작 시)
+	UFUNCTION(BlueprintCallable, Category = "Health")
+	void ResetHealth();
+	UFUNCTION(BlueprintPure, Category = "Health")
+	float GetHealthPercent() const { return Health / MaxHealth; }
+
+	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
+
+	void Move(const FInputActionValue& value);
+	void StartJump(const FInputActionValue& value);
+	void StopJump(const FInputActionValue& value);
+	void Look(const FInputActionValue& value);
+	void StartSprint(const FInputActionValue& value);
+	void StopSprint(const FInputActionValue& value);
+	void OnDeath();
+	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInsigator, AActor* DamageCauser) override;
+
+	void UpdateOverheadHP();
+};
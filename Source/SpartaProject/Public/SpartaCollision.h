@@ -0,0 +1,13 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+// 아이템 픽업 전용 오브젝트 채널 (DefaultEngine.ini의 [/Script/Engine.CollisionProfile]에서 "Pickup"으로 정의)
+// 기본 응답이 Ignore라서 다른 오브젝트와는 Overlap 쌍이 생기지 않고, 플레이어 캡슐만 Overlap으로 응답
+#define ECC_Pickup ECC_GameTraceChannel1
+
+// 아이템 픽업 구에 사용하는 프로파일 (Pickup 오브젝트, Pawn 채널과만 Overlap)
+#define SPARTA_PROFILE_PICKUP TEXT("Pickup")
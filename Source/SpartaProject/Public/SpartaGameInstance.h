@@ -1,26 +1,34 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "Engine/GameInstance.h"
-#include "SpartaGameInstance.generated.h"
-
-UCLASS()
-class SPARTAPROJECT_API USpartaGameInstance : public UGameInstance
-{
-	GENERATED_BODY()
-
-public:
-	USpartaGameInstance();
-
-	// 게임 전체 누적 점수
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "GameData")
-	int32 TotalScore;
-	// 현재 레벨 인덱스
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "GameData")
-	int32 CurrentLevelIndex;
-
-	UFUNCTION(BlueprintCallable, Category = "GameData")
-	void AddToScore(int32 Amount);
-};
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/GameInstance.h"
+#include "SpartaGameInstance.generated.h"
+
+UCLASS()
+class SPARTAPROJECT_API USpartaGameInstance : public UGameInstance
+{
+	GENERATED_BODY()
+
+public:
+	USpartaGameInstance();
+
+	virtual void Init() override;
+
+	// 게임 전체 누적 점수
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "GameData")
+	int32 TotalScore;
+	// 현재 레벨 인덱스
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "GameData")
+	int32 CurrentLevelIndex;
+	// 세션 시드 (-SpartaSeed=N 으로 지정, 같은 시드면 웨이브마다 같은 아이템/위치가 나옴)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GameData")
+	int32 SpawnSeed;
+	// 다음 레벨로 전환을 시작한 시각 (전환 중이 아니면 0)
+	// 맵을 새로 열면 GameState가 다시 만들어지므로 전환 시간을 재기 위해 게임 인스턴스에 보관
+	double LevelTransitionStartTime;
+
+	UFUNCTION(BlueprintCallable, Category = "GameData")
+	void AddToScore(int32 Amount);
+};
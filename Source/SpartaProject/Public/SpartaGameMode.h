@@ -1,16 +1,16 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/GameMode.h"
-#include "SpartaGameMode.generated.h"
-
-UCLASS()
-class SPARTAPROJECT_API ASpartaGameMode : public AGameMode
-{
-	GENERATED_BODY()
-
-public:
-	ASpartaGameMode();
-};
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameMode.h"
+#include "SpartaGameMode.generated.h"
+
+UCLASS()
+class SPARTAPROJECT_API ASpartaGameMode : public AGameMode
+{
+	GENERATED_BODY()
+
+public:
+	ASpartaGameMode();
+};
@@ -1,104 +1,223 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/GameState.h"
-#include "SpartaGameState.generated.h"
-
-// 웨이브 정보 구조체
-USTRUCT(BlueprintType)
-struct FWaveInfo
-{
-	GENERATED_BODY()
-
-	// 웨이브에서 스폰할 아이템 개수
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	int32 ItemCount;
-
-	// 웨이브 제한 시간
-	UPROPERTY(EditAnywhere, BlueprintReadWrite)
-	float Duration;
-
-	FWaveInfo()
-		: ItemCount(30)
-		, Duration(30.f)
-	{
-	}
-
-	FWaveInfo(int32 InItemCount, float InDuration)
-		: ItemCount(InItemCount)
-		, Duration(InDuration)
-	{
-	}
-};
-
-UCLASS()
-class SPARTAPROJECT_API ASpartaGameState : public AGameState
-{
-	GENERATED_BODY()
-
-public:
-	ASpartaGameState();
-	virtual void BeginPlay() override;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Score")
-	int32 Score;
-	// 현재 레벨에서 스폰된 코인 수
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Coin")
-	int32 SpawnedCoinCount;
-	// 플레이어가 수집한 코인 수
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Coin")
-	int32 CollectedCoinCount;
-	// 각 레벨이 유지되는 시간
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Level")
-	float LevelDuration;
-	// 현재 진행 중인 레벨 인덱스
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Level")
-	int32 CurrentLevelIndex;
-	// 총 레벨 수
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Level")
-	int32 MaxLevels;
-	// 레벨 맵 이름 배열
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Level")
-	TArray<FName> LevelMapNames;
-
-	// 웨이브 관련
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wave")
-	int32 CurrentWaveIndex;
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wave")
-	int32 MaxWavesPerLevel;
-
-	// 각 레벨의 웨이브 정보 (블루프린트에서 편집 가능)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave")
-	TArray<FWaveInfo> WaveInfos;
-
-	// 매 레벨이 끝나기 전까지 시간이 흐르도록 관리하는 타이머
-	FTimerHandle LevelTimerHandle;
-	FTimerHandle HUDUpdateTimerHandle;
-
-	UFUNCTION(BlueprintPure, Category = "Score")
-	int32 GetScore() const;
-	UFUNCTION(BlueprintCallable, Category = "Score")
-	void AddScore(int32 Amount);
-	// 게임이 완전히 끝났을 때 모든 레벨 종료
-	UFUNCTION(BlueprintCallable, Category = "Level")
-	void OnGameOver();
-
-	// 레벨을 시작할 때, 아이템 스폰 및 타이머 설정
-	void StartLevel();
-	// 웨이브 시작
-	void StartWave();
-	// 웨이브 종료 체크
-	void CheckWaveCompletion();
-	// 레벨 제한 시간이 만료되었을 때 호출
-	void OnWaveTimeUp();
-	// 레벨 제한 시간이 만료되었을 때 호출 (기존 함수 - 호환성)
-	void OnLevelTimeUp();
-	// 코인을 주웠을 때 호출
-	void OnCoinCollected();
-	// 레벨을 강제 종료, 다음 레벨로 이동
-	void EndLevel();
-	void UpdateHUD();
-};
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameState.h"
+#include "WaveManifest.h"
+#include "Async/Future.h"
+#include "SpartaGameState.generated.h"
+
+class ASpawnVolume;
+class ASpartaPlayerController;
+class ULevelStreaming;
+
+// 웨이브의 모든 아이템 스폰이 끝났을 때 호출
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWavePopulated, int32, LevelIndex, int32, WaveIndex);
+
+// 웨이브 정보 구조체
+USTRUCT(BlueprintType)
+struct FWaveInfo
+{
+	GENERATED_BODY()
+
+	// 웨이브에서 스폰할 아이템 개수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	int32 ItemCount;
+
+	// 웨이브 제한 시간
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float Duration;
+
+	FWaveInfo()
+		: ItemCount(30)
+		, Duration(30.f)
+	{
+	}
+
+	FWaveInfo(int32 InItemCount, float InDuration)
+		: ItemCount(InItemCount)
+		, Duration(InDuration)
+	{
+	}
+};
+
+UCLASS()
+class SPARTAPROJECT_API ASpartaGameState : public AGameState
+{
+	GENERATED_BODY()
+
+public:
+	ASpartaGameState();
+	virtual void BeginPlay() override;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "Score")
+	int32 Score;
+	// 현재 레벨에서 스폰된 코인 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Coin")
+	int32 SpawnedCoinCount;
+	// 플레이어가 수집한 코인 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Coin")
+	int32 CollectedCoinCount;
+	// 각 레벨이 유지되는 시간
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Level")
+	float LevelDuration;
+	// 현재 진행 중인 레벨 인덱스
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Level")
+	int32 CurrentLevelIndex;
+	// 총 레벨 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Level")
+	int32 MaxLevels;
+	// 레벨 맵 이름 배열
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Level")
+	TArray<FName> LevelMapNames;
+	// LevelMapNames가 퍼시스턴트 월드의 스트리밍 서브레벨이면 맵을 다시 열지 않고 표시만 전환
+	// 아레나 레벨들을 서브레벨로 가진 퍼시스턴트 맵이 아직 없어서 기본값은 꺼짐
+	// (켜도 서브레벨이 없으면 게임 모드의 bUseSeamlessTravel에 따라 ServerTravel 또는 OpenLevel 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Level")
+	bool bUseStreamedLevels;
+
+	// 웨이브 관련
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wave")
+	int32 CurrentWaveIndex;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wave")
+	int32 MaxWavesPerLevel;
+
+	// 각 레벨의 웨이브 정보 (블루프린트에서 편집 가능)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave")
+	TArray<FWaveInfo> WaveInfos;
+
+	// 웨이브 아이템을 여러 프레임에 나누어 스폰할지 여부
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave|Spawning")
+	bool bTimeSlicedSpawning;
+	// 프레임당 아이템 스폰에 사용할 수 있는 최대 시간 (밀리초)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Wave|Spawning", meta = (ClampMin = "0.1", EditCondition = "bTimeSlicedSpawning"))
+	float SpawnBudgetMs;
+	// 웨이브의 아이템 스폰이 모두 끝났는지 여부
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Wave|Spawning")
+	bool bWavePopulated;
+	UPROPERTY(BlueprintAssignable, Category = "Wave|Spawning")
+	FOnWavePopulated OnWavePopulated;
+
+	// 매 레벨이 끝나기 전까지 시간이 흐르도록 관리하는 타이머
+	FTimerHandle LevelTimerHandle;
+	FTimerHandle HUDUpdateTimerHandle;
+	FTimerHandle SpawnSliceTimerHandle;
+	FTimerHandle NextWaveTimerHandle;
+	// 초당 픽업 수 통계 갱신용 타이머
+	FTimerHandle PickupRateTimerHandle;
+
+	UFUNCTION(BlueprintPure, Category = "Score")
+	int32 GetScore() const;
+	UFUNCTION(BlueprintCallable, Category = "Score")
+	void AddScore(int32 Amount);
+	// 게임이 완전히 끝났을 때 모든 레벨 종료
+	UFUNCTION(BlueprintCallable, Category = "Level")
+	void OnGameOver();
+
+	// 레벨을 시작할 때, 아이템 스폰 및 타이머 설정
+	void StartLevel();
+	// 웨이브 시작
+	void StartWave();
+	// 웨이브 종료 체크
+	void CheckWaveCompletion();
+	// 레벨 제한 시간이 만료되었을 때 호출
+	void OnWaveTimeUp();
+	// 레벨 제한 시간이 만료되었을 때 호출 (기존 함수 - 호환성)
+	void OnLevelTimeUp();
+	// 코인을 주웠을 때 호출
+	void OnCoinCollected();
+	// 아이템이 사용될 때마다 호출 (stat Sparta의 초당 픽업 수 집계)
+	void RecordPickup();
+	// 레벨을 강제 종료, 다음 레벨로 이동
+	void EndLevel();
+	// 맵을 다시 열지 않고 지금 월드에서 첫 레벨부터 다시 시작할 수 있는지 여부
+	bool CanRestartInPlace() const;
+	// 아이템을 풀로 돌리고 캐릭터/웨이브/레벨 상태를 초기화한 뒤 첫 레벨부터 다시 시작
+	void RestartInPlace();
+	// 벤치마크처럼 게임 규칙 밖에서 아이템을 다룰 때 웨이브 진행을 멈춤
+	// 멈추면 웨이브 타이머/스폰을 취소하고 남은 아이템을 풀로 돌리며, 점수/코인 수집이 웨이브 상태를 바꾸지 않음
+	// 다시 켜면 현재 레벨의 첫 웨이브부터 시작
+	void SetWaveLoopSuspended(bool bSuspended);
+	bool IsWaveLoopSuspended() const { return bWaveLoopSuspended; }
+	// HUD 전체 갱신 (HUD가 새로 생성되었을 때 등)
+	void UpdateHUD();
+	// 변경 이벤트가 있을 때만 해당 항목 갱신
+	void UpdateTimeHUD();
+	void UpdateScoreHUD();
+	void UpdateLevelHUD();
+
+private:
+	// HUD를 가진 플레이어 컨트롤러 (한 번 찾아서 캐싱)
+	ASpartaPlayerController* GetHUDController();
+
+	TWeakObjectPtr<ASpartaPlayerController> CachedHUDController;
+
+	// LevelMapNames[LevelIndex]에 해당하는 스트리밍 서브레벨 (없으면 nullptr)
+	ULevelStreaming* GetStreamingLevel(int32 LevelIndex) const;
+	// 마지막 웨이브 동안 다음 레벨을 보이지 않는 상태로 미리 로드
+	void PreloadNextLevel();
+	// 다른 레벨은 숨기고 LevelIndex 레벨을 표시, 표시되면 StartLevel 호출 (스트리밍 레벨이 없으면 false)
+	bool TransitionToStreamedLevel(int32 LevelIndex);
+	UFUNCTION()
+	void OnStreamedLevelShown();
+	// 새로 표시된 레벨의 PlayerStart로 플레이어 이동
+	void MovePlayerToLevelStart(ULevel* Level);
+
+	TWeakObjectPtr<ULevelStreaming> PendingShownLevel;
+	// EndLevel에서 시작한 레벨 전환이 끝났으면 걸린 시간을 로그로 남김 (스트리밍/Seamless Travel/OpenLevel 공통)
+	void ReportLevelTransition();
+
+	// 진행 중인 웨이브/예약된 다음 웨이브를 취소하고 남은 아이템을 풀로 반환
+	void StopWaveLoop();
+	bool bWaveLoopSuspended;
+
+	// 최근 1초 동안의 픽업 수를 통계에 반영
+	void UpdatePickupRate();
+	int32 NumRecentPickups;
+	// 현재 웨이브가 끝나는 월드 시간 (남은 시간 표시용)
+	float WaveEndTime;
+	// 마지막으로 표시한 남은 시간 (0.1초 단위, 값이 바뀔 때만 텍스트 갱신)
+	int32 DisplayedTimeTenths;
+
+	// LevelIndex/WaveIndex 웨이브의 볼륨별 매니페스트를 워커 스레드에서 계산 시작 (웨이브 사이 대기 시간 동안)
+	void PrepareWaveManifests(int32 LevelIndex, int32 WaveIndex);
+	// 세션 시드 + 레벨/웨이브/볼륨 순번으로 만든 시드 (같은 시드면 같은 배치가 나오도록)
+	int32 GetWaveSeed(int32 LevelIndex, int32 WaveIndex, int32 VolumeIndex) const;
+	// 바닥 보정이 끝난 매니페스트의 아이템을 스폰 대기 목록에 추가
+	void OnWaveManifestReady(const TArray<FWaveManifestEntry>& Entries, TWeakObjectPtr<ASpawnVolume> WeakSpawnVolume, int32 WaveSerial);
+	// 예산 시간 안에서 대기 중인 아이템을 스폰하고, 남으면 다음 프레임으로 넘김
+	void SpawnWaveSlice();
+	// 대기 중인 스폰 작업 취소
+	void CancelPendingSpawns();
+
+	// 스폰 대기 중인 아이템 하나 (어느 볼륨에서 어떤 아이템을 어디에)
+	struct FPendingItemSpawn
+	{
+		TWeakObjectPtr<ASpawnVolume> Volume;
+		UClass* ItemClass;
+		FVector Location;
+		FRotator Rotation;
+	};
+
+	// 계산 중이거나 계산이 끝난 볼륨 하나의 매니페스트
+	struct FPreparedManifest
+	{
+		TWeakObjectPtr<ASpawnVolume> Volume;
+		TFuture<FWaveManifest> Manifest;
+	};
+
+	// 다음 웨이브용으로 미리 계산해둔 매니페스트와 그 레벨/웨이브 (없으면 INDEX_NONE)
+	TArray<FPreparedManifest> PreparedManifests;
+	int32 PreparedLevelIndex;
+	int32 PreparedWaveIndex;
+
+	// 스폰 대기 목록과 다음에 스폰할 인덱스
+	TArray<FPendingItemSpawn> PendingSpawns;
+	int32 NextPendingSpawnIndex;
+	// 아직 바닥 탐색 결과가 도착하지 않은 볼륨 수
+	int32 NumPendingPointBatches;
+	// 웨이브 스폰 요청 번호 (취소된 요청의 늦은 결과를 걸러내기 위함)
+	int32 SpawnWaveSerial;
+};
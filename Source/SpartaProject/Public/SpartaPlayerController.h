@@ -1,62 +1,77 @@
-﻿// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/PlayerController.h"
-#include "SpartaPlayerController.generated.h"
-
-class UInputMappingContext; // IMC 관련 전방 선언
-class UInputAction;			// IA 관련 전방 선언
-
-UCLASS()
-class SPARTAPROJECT_API ASpartaPlayerController : public APlayerController
-{
-	GENERATED_BODY()
-
-public:
-	ASpartaPlayerController();
-
-	// 에디터에서 세팅할 IMC
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
-	TObjectPtr<UInputMappingContext> InputMappingContext;
-	// IA_Move를 지정할 변수
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
-	TObjectPtr<UInputAction> MoveAction;
-	// IA_Jump를 지정할 변수
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
-	TObjectPtr<UInputAction> JumpAction;
-	// IA_Sprint를 지정할 변수
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
-	TObjectPtr<UInputAction> SprintAction;
-	// IA_Look를 지정할 변수
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
-	TObjectPtr<UInputAction> LookAction;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HUD")
-	TSubclassOf<UUserWidget> HUDWidgetClass;
-	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "HUD")
-	TObjectPtr<UUserWidget> HUDWidgetInstance;
-
-	// 메뉴 UI
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Menu")
-	TSubclassOf<UUserWidget> MainMenuWidgetClass;
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Menu")
-	UUserWidget* MainMenuWidgetInstance;
-
-	UFUNCTION(BlueprintPure, Category = "HUD")
-	UUserWidget* GetHUDWidget() const;
-
-	// HUD 표시
-	UFUNCTION(BlueprintCallable, Category = "HUD")
-	void ShowGameHUD();
-	// 메인 메뉴 표시
-	UFUNCTION(BlueprintCallable, Category = "Menu")
-	void ShowMainMenu(bool bIsRestart);
-	// 게임 시작
-	UFUNCTION(BlueprintCallable, Category = "Menu")
-	void StartGame();
-
-protected:
-	virtual void BeginPlay() override;
-};
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerController.h"
+#include "SpartaPlayerController.generated.h"
+
+class UInputMappingContext; // IMC 관련 전방 선언
+class UInputAction;			// IA 관련 전방 선언
+class UTextBlock;
+
+UCLASS()
+class SPARTAPROJECT_API ASpartaPlayerController : public APlayerController
+{
+	GENERATED_BODY()
+
+public:
+	ASpartaPlayerController();
+
+	// 에디터에서 세팅할 IMC
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	TObjectPtr<UInputMappingContext> InputMappingContext;
+	// IA_Move를 지정할 변수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	TObjectPtr<UInputAction> MoveAction;
+	// IA_Jump를 지정할 변수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	TObjectPtr<UInputAction> JumpAction;
+	// IA_Sprint를 지정할 변수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	TObjectPtr<UInputAction> SprintAction;
+	// IA_Look를 지정할 변수
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	TObjectPtr<UInputAction> LookAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HUD")
+	TSubclassOf<UUserWidget> HUDWidgetClass;
+	UPROPERTY(VisibleAnywhere, BlueprintReadWrite, Category = "HUD")
+	TObjectPtr<UUserWidget> HUDWidgetInstance;
+
+	// 메뉴 UI
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Menu")
+	TSubclassOf<UUserWidget> MainMenuWidgetClass;
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Menu")
+	UUserWidget* MainMenuWidgetInstance;
+
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	UUserWidget* GetHUDWidget() const;
+
+	// HUD 텍스트 갱신 (ShowGameHUD에서 한 번 찾아둔 TextBlock 사용)
+	void SetHUDTimeText(const FText& Text);
+	void SetHUDScoreText(const FText& Text);
+	void SetHUDLevelText(const FText& Text);
+
+	// HUD 표시
+	UFUNCTION(BlueprintCallable, Category = "HUD")
+	void ShowGameHUD();
+	// 메인 메뉴 표시
+	UFUNCTION(BlueprintCallable, Category = "Menu")
+	void ShowMainMenu(bool bIsRestart);
+	// 게임 시작
+	UFUNCTION(BlueprintCallable, Category = "Menu")
+	void StartGame();
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	// HUD 위젯 생성 시 이름으로 한 번만 찾아두는 TextBlock
+	UPROPERTY()
+	TObjectPtr<UTextBlock> HUDTimeText;
+	UPROPERTY()
+	TObjectPtr<UTextBlock> HUDScoreText;
+	UPROPERTY()
+	TObjectPtr<UTextBlock> HUDLevelText;
+};
@@ -0,0 +1,40 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// 웨이브 루프 핫패스 프로파일링용 통계 그룹 (콘솔에서 stat Sparta)
+// 각 구간은 SCOPE_CYCLE_COUNTER와 TRACE_CPUPROFILER_EVENT_SCOPE를 함께 사용해 Unreal Insights에도 표시
+DECLARE_STATS_GROUP(TEXT("Sparta"), STATGROUP_Sparta, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StartWave"), STAT_Sparta_StartWave, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SpawnWaveSlice"), STAT_Sparta_SpawnWaveSlice, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SpawnRandomItem"), STAT_Sparta_SpawnRandomItem, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetRandomItem"), STAT_Sparta_GetRandomItem, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetRandomPointInVolume"), STAT_Sparta_GetRandomPointInVolume, STATGROUP_Sparta, SPARTAPROJECT_API);
+// 매니페스트 계산 중 게임 스레드 부분 (테이블/클래스 확인, 워커 작업 시작)
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BuildWaveManifest"), STAT_Sparta_BuildWaveManifest, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ItemTick"), STAT_Sparta_ItemTick, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ActivateItem"), STAT_Sparta_ActivateItem, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Explode"), STAT_Sparta_Explode, STATGROUP_Sparta, SPARTAPROJECT_API);
+// Mass 아이템 프로세서 실행과 결과 적용
+DECLARE_CYCLE_STAT_EXTERN(TEXT("MassItemTick"), STAT_Sparta_MassItemTick, STATGROUP_Sparta, SPARTAPROJECT_API);
+// HUD 갱신 (시간/점수/레벨 각 항목 갱신을 합산)
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateHUD"), STAT_Sparta_UpdateHUD, STATGROUP_Sparta, SPARTAPROJECT_API);
+
+// 현재 월드에 활성화된 아이템 수
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Items"), STAT_Sparta_LiveItems, STATGROUP_Sparta, SPARTAPROJECT_API);
+// 현재 월드에 있는 Mass 아이템 엔티티 수
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Mass Items"), STAT_Sparta_MassItems, STATGROUP_Sparta, SPARTAPROJECT_API);
+// 중요도가 낮아 갱신을 줄이거나 멈춘 아이템 수
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Mid Significance Items"), STAT_Sparta_MidSignificanceItems, STATGROUP_Sparta, SPARTAPROJECT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Far Significance Items"), STAT_Sparta_FarSignificanceItems, STATGROUP_Sparta, SPARTAPROJECT_API);
+// 현재 웨이브에서 스폰된 아이템 수
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawns This Wave"), STAT_Sparta_SpawnsPerWave, STATGROUP_Sparta, SPARTAPROJECT_API);
+// 최근 1초 동안의 픽업 수
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pickups Per Second"), STAT_Sparta_PickupsPerSecond, STATGROUP_Sparta, SPARTAPROJECT_API);
+// 이번 프레임에 아이템 픽업 구에서 발생한 BeginOverlap 이벤트 수 (플레이어가 아닌 쌍이 섞이는지 확인용)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Item Overlap Events"), STAT_Sparta_ItemOverlapEvents, STATGROUP_Sparta, SPARTAPROJECT_API);
@@ -1,47 +1,240 @@
-// Fill out your copyright notice in the Description page of Project Settings.
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "GameFramework/Actor.h"
-#include "ItemSpawnRow.h"
-#include "SpawnVolume.generated.h"
-
-class UBoxComponent;
-
-UCLASS()
-class SPARTAPROJECT_API ASpawnVolume : public AActor
-{
-	GENERATED_BODY()
-
-public:
-	ASpawnVolume();
-
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spawning")
-	TObjectPtr<USceneComponent> Scene;
-	// 스폰 영역을 정의하는 박스 컴포넌트
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spawning")
-	TObjectPtr<UBoxComponent> SpawningBox;
-
-	// 각 레벨/웨이브별 아이템 DataTable 배열 (9개: 3레벨 x 3웨이브)
-	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning")
-	TArray<TObjectPtr<UDataTable>> ItemDataTables;
-
-	// 현재 사용할 DataTable 인덱스 설정
-	UFUNCTION(BlueprintCallable, Category = "Spawning")
-	void SetCurrentDataTableIndex(int32 LevelIndex, int32 WaveIndex);
-
-	UFUNCTION(BlueprintCallable, Category = "Spawning")
-	AActor* SpawnRandomItem();
-	FItemSpawnRow* GetRandomItem() const;
-	// 특정 아이템 클래스를 스폰하는 함수
-	UFUNCTION(BlueprintCallable, Category = "Spawning")
-	AActor* SpawnItem(TSubclassOf<AActor> ItemClass);
-	// 스폰 볼륨 내부에서 무작위 좌표를 얻어오는 함수
-	UFUNCTION(BlueprintCallable, Category = "Spawning")
-	FVector GetRandomPointInVolume() const;
-
-private:
-	// 현재 사용 중인 DataTable
-	TObjectPtr<UDataTable> CurrentItemDataTable;
-};
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ItemSpawnRow.h"
+#include "ItemSpawnSampler.h"
+#include "WaveManifest.h"
+#include "Async/Future.h"
+#include "SpawnVolume.generated.h"
+
+class UBoxComponent;
+class ABaseItem;
+struct FTraceHandle;
+struct FTraceDatum;
+struct FStreamableHandle;
+
+// 바닥 보정까지 끝난 웨이브 매니페스트를 전달받는 델리게이트
+DECLARE_DELEGATE_OneParam(FOnManifestReady, const TArray<FWaveManifestEntry>& /*Entries*/);
+
+// 웨이브 아이템 위치를 고르는 방식
+UENUM(BlueprintType)
+enum class ESpawnPlacementMode : uint8
+{
+	// 박스 안에서 균등 무작위 (아이템이 겹칠 수 있음)
+	Uniform,
+	// 최소 간격을 지키는 블루 노이즈 배치
+	PoissonDisc
+};
+
+// 아이템 풀 사용 현황
+USTRUCT(BlueprintType)
+struct FItemPoolStats
+{
+	GENERATED_BODY()
+
+	// SpawnActor로 새로 생성된 아이템 수 (프리웜 포함)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumCreated = 0;
+	// 풀에서 꺼내 재사용된 횟수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumReused = 0;
+	// 풀로 반환된 횟수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumReleased = 0;
+	// 현재 월드에서 활성화된 아이템 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumActive = 0;
+	// 현재 풀에서 대기 중인 아이템 수
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 NumAvailable = 0;
+};
+
+// 클래스별 대기 중인 아이템 목록
+USTRUCT()
+struct FItemPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<ABaseItem>> FreeItems;
+};
+
+UCLASS()
+class SPARTAPROJECT_API ASpawnVolume : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ASpawnVolume();
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spawning")
+	TObjectPtr<USceneComponent> Scene;
+	// 스폰 영역을 정의하는 박스 컴포넌트
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Spawning")
+	TObjectPtr<UBoxComponent> SpawningBox;
+
+	// 각 레벨/웨이브별 아이템 DataTable 배열 (9개: 3레벨 x 3웨이브)
+	// 필요한 웨이브의 테이블과 아이템 클래스만 PreloadDataTable로 미리 로드
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning")
+	TArray<TSoftObjectPtr<UDataTable>> ItemDataTables;
+
+	// 웨이브 아이템을 여러 볼륨에 나눌 때의 가중치 (0 이하이면 박스 부피를 사용)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning")
+	float SpawnWeight;
+
+	// 웨이브 아이템 위치 배치 방식
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning|Placement")
+	ESpawnPlacementMode PlacementMode;
+	// PoissonDisc 배치에서 아이템 사이의 최소 수평 거리
+	// 이 간격으로 볼륨 바닥에 다 들어가지 않는 만큼은 간격 없이 균등 무작위로 배치하고 경고를 남김
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning|Placement", meta = (ClampMin = "1.0", EditCondition = "PlacementMode == ESpawnPlacementMode::PoissonDisc"))
+	float MinItemSeparation;
+
+	// 에디터에서 미리 구워둔 바닥 위 스폰 위치 (액터 기준 로컬 좌표, 볼륨을 옮겼다면 다시 구워야 함)
+	UPROPERTY(VisibleAnywhere, Category = "Spawning|Baked")
+	TArray<FVector3f> BakedSpawnPoints;
+	// 구울 스폰 위치 개수
+	UPROPERTY(EditAnywhere, Category = "Spawning|Baked", meta = (ClampMin = "1"))
+	int32 NumPointsToBake;
+	// 구워둔 위치가 있으면 런타임 바닥 탐색 없이 그 중에서 선택
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning|Baked")
+	bool bUseBakedSpawnPoints;
+
+	// 박스 안을 샘플링해 바닥을 찾은 위치만 BakedSpawnPoints에 저장
+	UFUNCTION(CallInEditor, Category = "Spawning|Baked")
+	void BakeSpawnPoints();
+	bool HasBakedSpawnPoints() const { return bUseBakedSpawnPoints && BakedSpawnPoints.Num() > 0; }
+
+	// 프리웜 기준이 되는 웨이브당 최대 아이템 수
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spawning|Pool")
+	int32 PoolPrewarmItemCount;
+
+	// 이번 웨이브의 아이템 선택/위치 난수 시드 설정
+	void SetSpawnSeed(int32 Seed);
+
+	// 현재 사용할 DataTable 인덱스 설정 (미리 로드 중이면 완료를 기다리고, 요청한 적 없으면 동기 로드)
+	UFUNCTION(BlueprintCallable, Category = "Spawning")
+	void SetCurrentDataTableIndex(int32 LevelIndex, int32 WaveIndex);
+	// 다음에 사용할 DataTable과 아이템 클래스를 비동기로 로드하고, 로드가 끝나면 풀도 미리 채움
+	// 현재/다음 테이블이 아닌 이전 로드 요청은 해제
+	UFUNCTION(BlueprintCallable, Category = "Spawning")
+	void PreloadDataTable(int32 LevelIndex, int32 WaveIndex);
+
+	// 아이템 분배에 사용할 실제 가중치
+	UFUNCTION(BlueprintPure, Category = "Spawning")
+	float GetSpawnWeight() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Spawning")
+	AActor* SpawnRandomItem();
+	FItemSpawnRow* GetRandomItem() const;
+	// 특정 아이템 클래스를 스폰하는 함수
+	UFUNCTION(BlueprintCallable, Category = "Spawning")
+	AActor* SpawnItem(TSubclassOf<AActor> ItemClass);
+	AActor* SpawnItemAt(TSubclassOf<AActor> ItemClass, const FVector& Location, const FRotator& Rotation = FRotator::ZeroRotator);
+	// 스폰 볼륨 내부에서 무작위 좌표를 얻어오는 함수
+	UFUNCTION(BlueprintCallable, Category = "Spawning")
+	FVector GetRandomPointInVolume() const;
+
+	// 웨이브의 아이템 선택과 위치 배치를 워커 스레드에서 미리 계산
+	// 테이블 로드와 아이템 클래스 확인, 볼륨 정보 복사만 게임 스레드에서 하고 나머지는 Seed만으로 결정됨
+	TFuture<FWaveManifest> BuildWaveManifestAsync(int32 LevelIndex, int32 WaveIndex, int32 Count, int32 Seed);
+	// 매니페스트 위치를 비동기 LineTrace로 바닥에 맞춘 뒤 OnReady로 전달 (구워둔 위치면 탐색 없이 다음 프레임에 전달)
+	void ResolveManifest(FWaveManifest&& Manifest, FOnManifestReady OnReady);
+
+	// 로드되어 있는 DataTable의 아이템 클래스를 미리 생성해 풀에 채워두는 함수
+	UFUNCTION(BlueprintCallable, Category = "Spawning|Pool")
+	void PrewarmPool();
+	// 사용이 끝난 아이템을 풀로 반환하는 함수
+	void ReleaseItem(ABaseItem* Item);
+	// 월드에 나와 있는 이 볼륨의 아이템을 모두 풀로 반환 (게임 재시작 시)
+	UFUNCTION(BlueprintCallable, Category = "Spawning|Pool")
+	void ReleaseAllItems();
+	UFUNCTION(BlueprintPure, Category = "Spawning|Pool")
+	FItemPoolStats GetPoolStats() const;
+
+private:
+	// 비동기 바닥 탐색 중인 스폰 위치 묶음
+	struct FPendingSpawnPoints
+	{
+		TArray<FWaveManifestEntry> Entries;
+		int32 NumPendingTraces = 0;
+		FOnManifestReady OnReady;
+	};
+
+	// 위치 배치에 필요한 볼륨 정보 (워커 스레드에서 액터에 접근하지 않도록 복사해서 사용)
+	struct FPlacementParams
+	{
+		FString VolumeName;
+		FVector BoxOrigin = FVector::ZeroVector;
+		FVector BoxExtent = FVector::ZeroVector;
+		ESpawnPlacementMode PlacementMode = ESpawnPlacementMode::Uniform;
+		float MinItemSeparation = 0.f;
+		// 월드 좌표로 변환한 구워둔 위치 (비어 있으면 박스 안에서 생성)
+		TArray<FVector> BakedPoints;
+	};
+
+	FPlacementParams MakePlacementParams() const;
+	// 박스 내부의 무작위 좌표 (바닥 보정 전)
+	FVector GetRandomPointInBox() const;
+	// 구워둔 위치가 있으면 그 중에서, 없으면 박스 안에서 Count개 위치를 고름 (어느 스레드에서나 호출 가능)
+	static void GetPlacementPoints(const FPlacementParams& Params, int32 Count, const FRandomStream& Stream, TArray<FVector>& OutPoints);
+	// 구워둔 위치에서 Count개를 겹치지 않게 고름 (Count가 더 많으면 중복 허용)
+	static void DrawBakedSpawnPoints(const FPlacementParams& Params, int32 Count, const FRandomStream& Stream, TArray<FVector>& OutPoints);
+	// 배치 방식에 따라 박스 안의 Count개 위치를 생성 (바닥 보정 전)
+	static void GetBoxPlacementPoints(const FPlacementParams& Params, int32 Count, const FRandomStream& Stream, TArray<FVector>& OutPoints);
+	// 바닥 탐색용 LineTrace 구간
+	void GetFloorTraceSegment(const FVector& Point, FVector& OutStart, FVector& OutEnd) const;
+	void OnFloorTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum, uint32 BatchId);
+
+	TMap<uint32, FPendingSpawnPoints> PendingSpawnPoints;
+	uint32 NextSpawnPointBatchId;
+
+	// 테이블 인덱스별 로드 요청 (핸들이 살아있는 동안 테이블과 아이템 클래스가 메모리에 유지됨)
+	struct FDataTablePreload
+	{
+		TSharedPtr<FStreamableHandle> TableHandle;
+		TSharedPtr<FStreamableHandle> ClassHandle;
+	};
+
+	static int32 GetDataTableIndex(int32 LevelIndex, int32 WaveIndex) { return LevelIndex * 3 + WaveIndex; }
+	// 테이블 로드가 끝난 뒤 Row의 아이템 클래스를 로드
+	void OnDataTablePreloaded(int32 TableIndex);
+	void OnItemClassesPreloaded(int32 TableIndex);
+	void ReleasePreload(int32 TableIndex);
+	// 테이블에 들어있는 아이템 클래스 경로
+	static void GetItemClassPaths(const UDataTable* DataTable, TArray<FSoftObjectPath>& OutPaths);
+	// 한 테이블 기준으로 풀을 채움
+	void PrewarmPoolForTable(const UDataTable* DataTable);
+	// Row의 아이템 클래스 (로드되지 않았다면 동기 로드)
+	static UClass* ResolveItemClass(const FItemSpawnRow& Row);
+
+	TMap<int32, FDataTablePreload> DataTablePreloads;
+	int32 CurrentDataTableIndex;
+
+	// 풀에서 아이템을 꺼내거나, 비어 있으면 새로 생성
+	ABaseItem* AcquireItem(UClass* ItemClass, const FVector& Location, const FRotator& Rotation);
+	// 새 아이템 액터를 생성 (이 볼륨을 Owner로 지정)
+	ABaseItem* CreatePooledItem(UClass* ItemClass, const FVector& Location, const FRotator& Rotation);
+
+	// 아이템 클래스별 풀
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FItemPool> ItemPools;
+	FItemPoolStats PoolStats;
+	// 풀에서 꺼내져 월드에 나와 있는 아이템
+	UPROPERTY()
+	TSet<TObjectPtr<ABaseItem>> ActiveItems;
+
+	// 현재 사용 중인 DataTable
+	UPROPERTY(Transient)
+	TObjectPtr<UDataTable> CurrentItemDataTable;
+	// 현재 DataTable로 만든 가중치 샘플러 (테이블이 바뀔 때만 재생성)
+	FItemSpawnSampler ItemSampler;
+	// 아이템 선택과 스폰 위치에 쓰는 난수 (웨이브마다 시드를 다시 받음)
+	FRandomStream SpawnStream;
+};
@@ -0,0 +1,30 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpawnVolumeSubsystem.generated.h"
+
+class ASpawnVolume;
+
+// 월드에 배치된 SpawnVolume 목록을 관리하는 서브시스템
+// 볼륨이 BeginPlay/EndPlay에서 직접 등록/해제하므로 액터 전체를 순회할 필요가 없음
+UCLASS()
+class SPARTAPROJECT_API USpawnVolumeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterVolume(ASpawnVolume* Volume);
+	void UnregisterVolume(ASpawnVolume* Volume);
+
+	const TArray<TObjectPtr<ASpawnVolume>>& GetVolumes() const { return Volumes; }
+
+	// TotalCount를 등록된 볼륨들의 가중치 비율로 나눔 (OutCounts는 GetVolumes()와 같은 순서)
+	void DistributeItemCount(int32 TotalCount, TArray<int32>& OutCounts) const;
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<ASpawnVolume>> Volumes;
+};
@@ -0,0 +1,22 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 웨이브에서 스폰할 아이템 하나 (클래스 / 위치 / 방향)
+struct FWaveManifestEntry
+{
+	UClass* ItemClass = nullptr;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+};
+
+// 볼륨 하나가 한 웨이브에 스폰할 아이템 목록
+// 워커 스레드에서 만들어지므로 UObject는 게임 스레드에서 미리 확인해둔 클래스 포인터만 담음
+struct FWaveManifest
+{
+	TArray<FWaveManifestEntry> Entries;
+	// 구워둔 위치에서 골라 이미 바닥 위에 있는지 (false면 바닥 탐색 필요)
+	bool bGrounded = false;
+};
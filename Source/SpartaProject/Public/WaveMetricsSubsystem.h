@@ -0,0 +1,60 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WaveMetricsSubsystem.generated.h"
+
+// 웨이브마다 게임플레이/성능 지표를 모아 CSV 한 줄로 기록하는 서브시스템
+// 파일 쓰기와 프레임 시간 정렬(p99)은 워커 스레드에서 처리 (Saved/Profiling/SpartaWaveMetrics.csv)
+// CSV 프로파일러 캡처 중이면 웨이브 시작/종료 이벤트도 함께 남김
+UCLASS()
+class SPARTAPROJECT_API UWaveMetricsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+	void BeginWave(int32 LevelIndex, int32 WaveIndex, int32 ItemCount, float Duration);
+	// 웨이브의 아이템 스폰이 모두 끝났을 때 호출 (스폰 소요 시간 기록)
+	void MarkWavePopulated();
+	// bAllCollected: 모든 코인을 모아서 끝났으면 true, 시간 초과면 false
+	void EndWave(int32 SpawnedCoinCount, int32 CollectedCoinCount, bool bAllCollected);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// 웨이브 하나의 기록 (프레임 시간 통계는 워커 스레드에서 계산)
+	struct FWaveRecord
+	{
+		int32 LevelIndex = 0;
+		int32 WaveIndex = 0;
+		int32 ItemCount = 0;
+		float Duration = 0.f;
+		int32 SpawnedCoinCount = 0;
+		int32 CollectedCoinCount = 0;
+		const TCHAR* EndReason = TEXT("");
+		double TimeToSpawnMs = -1.0;
+		double WaveSeconds = 0.0;
+		int32 PeakActorCount = 0;
+		double MemoryDeltaMB = 0.0;
+		TArray<float> FrameTimesMs;
+	};
+
+	void FinishWave(const TCHAR* EndReason);
+	void WriteRecordAsync(FWaveRecord&& Record);
+
+	bool bWaveActive = false;
+	FWaveRecord CurrentRecord;
+	double WaveStartSeconds = 0.0;
+	uint64 WaveStartUsedPhysical = 0;
+
+	// 이전 웨이브 기록이 아직 쓰는 중이면 순서를 지키기 위해 기다림
+	TFuture<void> PendingWrite;
+};
@@ -0,0 +1,41 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SpartaBenchmarkSubsystem.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_AUTOMATION_TESTS
+
+// 벤치마크 맵이 로드된 게임 월드에서 Sparta.Benchmark와 같은 측정을 실행하고 결과를 테스트 성공/실패로 전달
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FRunSpartaBenchmarkCommand, FAutomationTestBase*, Test, TArray<FString>, Args);
+
+bool FRunSpartaBenchmarkCommand::Update()
+{
+	UWorld* World = AutomationCommon::GetAnyGameWorld();
+	USpartaBenchmarkSubsystem* BenchmarkSubsystem = World ? World->GetSubsystem<USpartaBenchmarkSubsystem>() : nullptr;
+	if (!BenchmarkSubsystem)
+	{
+		Test->AddError(TEXT("No game world with the benchmark subsystem (run the tests with -game)"));
+		return true;
+	}
+
+	// 각 항목을 여러 번 측정한 중앙값을 기준값과 비교
+	Test->TestTrue(TEXT("Spawn/pickup timings are within the baseline tolerance"), BenchmarkSubsystem->RunBenchmark(Args));
+	return true;
+}
+
+// 실행 예: UnrealEditor-Cmd SpartaProject.uproject -game -nullrhi -unattended -ExecCmds="Automation RunTests Sparta.Benchmark;Quit"
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSpartaSpawnPickupBenchmarkTest, "Sparta.Benchmark.SpawnAndPickup",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FSpartaSpawnPickupBenchmarkTest::RunTest(const FString& Parameters)
+{
+	// 기본 맵(메뉴)에는 SpawnVolume이 없으므로 벤치마크 맵을 열고 로드가 끝난 뒤 측정
+	AutomationOpenMap(USpartaBenchmarkSubsystem::DefaultMapName);
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(1.f));
+	ADD_LATENT_AUTOMATION_COMMAND(FRunSpartaBenchmarkCommand(this, { TEXT("Runs=9") }));
+	return true;
+}
+
+#endif // WITH_AUTOMATION_TESTS